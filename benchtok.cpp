@@ -0,0 +1,229 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <random>
+
+#include "bpe.h"
+#include "json.hpp"
+
+using json = nlohmann::json;
+
+// best of a few runs over all words, in nanoseconds per byte
+static double time_merge(bpecpp::BPE& bpe,
+                         const std::vector<std::string>& words) {
+    size_t bytes = 0;
+    for (auto& word : words) {
+        bytes += word.size();
+    }
+    std::vector<uint32_t> out;
+    double best = 1e30;
+    for (int run = 0; run < 3; run++) {
+        auto start = std::chrono::steady_clock::now();
+        for (auto& word : words) {
+            out.clear();
+            bpe.encode_pretoken(word, out);
+        }
+        auto end = std::chrono::steady_clock::now();
+        best = std::min(
+            best,
+            std::chrono::duration<double, std::nano>(end - start).count());
+    }
+    return best / bytes;
+}
+
+// the same for all words handed over at once
+static double time_batch(bpecpp::BPE& bpe,
+                         const std::vector<std::string>& words) {
+    size_t bytes = 0;
+    for (auto& word : words) {
+        bytes += word.size();
+    }
+    std::vector<uint32_t> out;
+    std::vector<size_t> ends;
+    double best = 1e30;
+    for (int run = 0; run < 3; run++) {
+        auto start = std::chrono::steady_clock::now();
+        out.clear();
+        ends.clear();
+        bpe.encode_pretokens(words, out, ends);
+        auto end = std::chrono::steady_clock::now();
+        best = std::min(
+            best,
+            std::chrono::duration<double, std::nano>(end - start).count());
+    }
+    return best / bytes;
+}
+
+// a single run of encode, in milliseconds. the slow cases take seconds
+static double time_encode(bpecpp::BPE& bpe, const std::string& input) {
+    auto start = std::chrono::steady_clock::now();
+    bpe.encode(input);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main(int argc, char** argv) {
+    std::ifstream f(argc > 1 ? argv[1] : "../mpt-7b-chat-tokenizer.json");
+    json tokenizer_config = json::parse(f);
+    json bpeconfig = tokenizer_config.at("model");
+    bpecpp::BPE bpe(bpeconfig.at("vocab"), bpeconfig.at("merges"));
+
+    // words are built from lowercase vocab entries so they merge like
+    // real text rather than like random letters
+    std::vector<std::string> pieces;
+    for (auto& item : bpeconfig.at("vocab").items()) {
+        const std::string& s = item.key();
+        if (std::all_of(s.begin(), s.end(),
+                        [](char c) { return c >= 'a' && c <= 'z'; }))
+            pieces.push_back(s);
+    }
+    std::mt19937 rng(1);
+
+    const size_t lengths[] = {2,  3,  4,   6,   8,   12,   16,  24,
+                              32, 48, 64, 96, 128, 256, 1024, 4096};
+    const bpecpp::bpe_engine engines[] = {bpecpp::bpe_engine::naive,
+                                          bpecpp::bpe_engine::heap,
+                                          bpecpp::bpe_engine::backtrack,
+                                          bpecpp::bpe_engine::rank_array};
+    bpecpp::adaptive_thresholds suggested;
+    suggested.naive_max = 0;
+    suggested.rank_array_max = 0;
+    bool naive_wins = true;
+    std::cerr << "bytes\tnaive\theap\tbacktrack\trank_array\tbatched (ns/byte)" << std::endl;
+    for (size_t len : lengths) {
+        // about 256KB of " word" pretokens of the given length
+        std::vector<std::string> words;
+        for (size_t total = 0; total < (1 << 18); total += len + 1) {
+            std::string word = " ";
+            while (word.size() < len + 1) {
+                word += pieces[rng() % pieces.size()];
+            }
+            word.resize(len + 1);
+            words.push_back(word);
+        }
+        double ns[4];
+        for (int e = 0; e < 4; e++) {
+            bpe.set_engine(engines[e]);
+            ns[e] = time_merge(bpe, words);
+        }
+        // encode_pretokens in adaptive mode, which merges short words in
+        // vector lanes in an AVX2 build
+        bpe.set_engine(bpecpp::bpe_engine::adaptive);
+        bpecpp::adaptive_thresholds lanes;
+        lanes.lanes_max = 16;
+        bpe.set_adaptive_thresholds(lanes);
+        double batched = time_batch(bpe, words);
+        std::cerr << len << "\t" << ns[0] << "\t" << ns[1] << "\t" << ns[2]
+                  << "\t" << ns[3] << "\t" << batched << std::endl;
+        // pretokens carry the leading space, so they are len + 1 bytes.
+        // naive keeps the lengths it wins from the shortest one up
+        if (naive_wins && ns[0] <= std::min(ns[3], ns[2]))
+            suggested.naive_max = len + 1;
+        else
+            naive_wins = false;
+        if (ns[3] <= ns[2])
+            suggested.rank_array_max = len + 1;
+    }
+    suggested.rank_array_max =
+        std::max(suggested.rank_array_max, suggested.naive_max);
+
+    // the lanes only pay off when the 8 pretokens in them are about as
+    // long, so lanes_max is measured on the mixed lengths of text rather
+    // than on the words above. it stays 0 unless a value beats that
+    std::string text;
+    const char* separators[] = {" ",  " ",  " ",  " ",
+                                ", ", ". ", "\n", " 42 "};
+    while (text.size() < (1 << 18)) {
+        text += separators[rng() % 8];
+        for (size_t n = 1 + rng() % 3; n; n--) {
+            text += pieces[rng() % pieces.size()];
+        }
+    }
+    std::vector<std::string> mixed = bpe.pretokenize(text);
+    bpe.set_engine(bpecpp::bpe_engine::adaptive);
+    std::cerr << "\nlanes_max\tmixed text (ns/byte)" << std::endl;
+    double best = 0;
+    for (size_t lanes_max : {0, 8, 12, 16}) {
+        bpecpp::adaptive_thresholds thresholds = suggested;
+        thresholds.lanes_max = lanes_max;
+        bpe.set_adaptive_thresholds(thresholds);
+        double ns = time_batch(bpe, mixed);
+        std::cerr << lanes_max << "\t" << ns << std::endl;
+        if (!lanes_max || ns < best) {
+            best = ns;
+            suggested.lanes_max = lanes_max;
+        }
+    }
+    std::cerr << "suggested adaptive_thresholds: naive_max = "
+              << suggested.naive_max
+              << ", rank_array_max = " << suggested.rank_array_max
+              << ", lanes_max = " << suggested.lanes_max << std::endl;
+    bpe.set_adaptive_thresholds(bpecpp::adaptive_thresholds());
+
+    // inputs that are one huge pretoken, against the quadratic engines with
+    // and without bpe_options::max_pretoken_bytes. the runs of one byte
+    // come out of the run tables whatever the engine
+    std::string base64;
+    const char* base64_chars =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    while (base64.size() < (1 << 20)) {
+        base64 += base64_chars[rng() % 64];
+    }
+    std::string han;
+    while (han.size() < 90000) {
+        han += "\xe4\xb8\xad";
+    }
+    const std::pair<const char*, std::string> pathological[] = {
+        {"100k spaces", std::string(100000, ' ')},
+        {"1MB base64", base64},
+        {"100k x a", std::string(100000, 'a')},
+        {"30k x U+4E2D", han},
+        {"100k digits", std::string(100000, '7')},
+    };
+    bpecpp::bpe_options guarded_options;
+    guarded_options.max_pretoken_bytes = 1024;
+    bpecpp::BPE guarded(bpeconfig.at("vocab"), bpeconfig.at("merges"),
+                        guarded_options);
+    const bpecpp::bpe_engine quadratic[] = {bpecpp::bpe_engine::naive,
+                                            bpecpp::bpe_engine::rank_array};
+    std::cerr << "\ninput\tadaptive\tnaive\trank_array\t(ms, unlimited / "
+                 "max_pretoken_bytes = 1024)"
+              << std::endl;
+    for (auto& input : pathological) {
+        bpe.set_engine(bpecpp::bpe_engine::adaptive);
+        guarded.set_engine(bpecpp::bpe_engine::adaptive);
+        std::cerr << input.first << "\t" << time_encode(bpe, input.second)
+                  << " / " << time_encode(guarded, input.second);
+        for (auto engine : quadratic) {
+            bpe.set_engine(engine);
+            guarded.set_engine(engine);
+            std::cerr << "\t" << time_encode(bpe, input.second) << " / "
+                      << time_encode(guarded, input.second);
+        }
+        std::cerr << std::endl;
+    }
+
+#ifndef BPECPP_NO_ICU
+    // a pattern without a scanner that backtracks exponentially on a run
+    // of letters, stopped by bpe_options::regex_time_limit
+    bpecpp::bpe_options regex_options;
+    regex_options.pretokenizer_regex = "(?:\\p{L}+)+!|\\s+|.";
+    regex_options.regex_time_limit = 100;
+    bpecpp::BPE backtracking(bpeconfig.at("vocab"), bpeconfig.at("merges"),
+                             regex_options);
+    auto start = std::chrono::steady_clock::now();
+    try {
+        backtracking.encode(std::string(64, 'a'));
+        std::cerr << "the regex time limit did not hit" << std::endl;
+    } catch (const bpecpp::bpe_limit_error& e) {
+        std::cerr << e.what() << " after "
+                  << std::chrono::duration<double, std::milli>(
+                         std::chrono::steady_clock::now() - start)
+                         .count()
+                  << "ms" << std::endl;
+    }
+#endif
+    return 0;
+}
@@ -1,54 +1,398 @@
 #include "bpe.h"
-#include <unicode/normalizer2.h>
+#include "json.hpp"
+#include "unicode.h"
+
+#ifndef BPECPP_NO_ICU
 #include <unicode/regex.h>
-#include <unicode/schriter.h>
 #include <unicode/unistr.h>
+#include <unicode/utext.h>
+#endif
 
+#include <algorithm>
+#include <functional>
+#include <queue>
 #include <regex>
 #include <stdexcept>
+#include <tuple>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 namespace bpecpp {
-const std::string BPE_PRETOK_REGEX =
-    R"('s|'t|'re|'ve|'m|'ll|'d| ?[[:alpha:]]+| ?[[:digit:]]+| ?[^\s[:alpha:][:digit:]]+|\s+(?!\S)|\s+)";
+// up to 8 bytes as one little-endian integer, zero padded
+static uint64_t pack_bytes(const char* s, size_t len) {
+    uint64_t packed = 0;
+    for (size_t i = 0; i < len; i++) {
+        packed |= (uint64_t)(uint8_t)s[i] << (8 * i);
+    }
+    return packed;
+}
 
-static void get_bigrams(const std::vector<icu::UnicodeString>& input,
-                        std::unordered_set<UnicodeBigram, bigram_hash>& pairs) {
-    pairs.clear();
-    auto i = input.begin();
-    auto prev = *i++;
-    for (; i != input.end(); ++i) {
-        pairs.insert({prev, *i});
-        prev = *i;
+// up to 7 bytes and their length as one integer, so that bytes ending in
+// zeros do not pack like the shorter string without them
+static uint64_t short_key(const char* s, size_t len) {
+    return pack_bytes(s, len) | (uint64_t)len << 56;
+}
+
+static uint64_t hash_bytes(const char* s, size_t len) {
+    uint64_t h = 0xcbf29ce484222325ull ^ len;
+    for (size_t i = 0; i < len; i += 8) {
+        h = (h ^ pack_bytes(s + i, std::min<size_t>(8, len - i))) *
+            0x9e3779b97f4a7c15ull;
+        h ^= h >> 29;
     }
+    return h;
+}
+
+// vocab and merges spell bytes with the printable alphabet of
+// bpe_char_byte_table. false if s uses a character outside of it
+static bool alphabet_to_bytes(const bpe_char_byte_table& table,
+                              const std::string& s,
+                              std::string& bytes) {
+    bytes.clear();
+    int32_t i = 0, len = (int32_t)s.size();
+    while (i < len) {
+        int32_t c = utf8_next(s.data(), i, len);
+        int byte = c < 0 ? -1 : table.find_byte((uint32_t)c);
+        if (byte < 0)
+            return false;
+        bytes.push_back((char)byte);
+    }
+    return true;
 }
 
 BPE::BPE(std::unordered_map<std::string, uint32_t> vocab,
-         std::vector<std::string> merges) {
-    for (auto pair : vocab) {
-        icu::UnicodeString encd = icu::UnicodeString::fromUTF8(pair.first);
-        m_vocab[encd] = pair.second;
-        m_reverse_vocab[pair.second] = encd;
+         std::vector<std::string> merges,
+         const bpe_options& options)
+    : m_pretok_regex(options.pretokenizer_regex.empty()
+                         ? BPE_PRETOK_REGEX
+                         : options.pretokenizer_regex),
+      m_pretokenizer(pretokenizer_for(m_pretok_regex)),
+      m_normalize(options.normalize),
+      m_add_prefix_space(options.add_prefix_space),
+      m_max_pretoken_bytes(options.max_pretoken_bytes) {
+    // a cut backs up at most 3 bytes to the start of a UTF-8 character
+    if (m_max_pretoken_bytes && m_max_pretoken_bytes < 4)
+        throw std::runtime_error("max_pretoken_bytes has to be 0 or at least 4");
+#ifndef BPECPP_NO_ICU
+    m_regex_time_limit = options.regex_time_limit;
+    m_regex_stack_limit = options.regex_stack_limit;
+    UParseError pe;
+    UErrorCode uerror = U_ZERO_ERROR;
+    m_pretok_re.reset(icu::RegexPattern::compile(
+        icu::UnicodeString::fromUTF8(m_pretok_regex), pe, uerror));
+    if (!U_SUCCESS(uerror))
+        throw std::runtime_error("Compiling BPE pretokenizer regex failed");
+#else
+    if (m_pretokenizer == pretokenizer_kind::regex)
+        throw std::runtime_error(
+            "BPE pretokenizer regex has no scanner and needs ICU");
+#endif
+    uint32_t max_id = 0;
+    for (auto& pair : vocab) {
+        max_id = std::max(max_id, pair.second);
+    }
+    std::vector<uint64_t> counts = options.token_counts;
+    if (counts.empty() && !options.frequency_sample.empty()) {
+        // encodes the sample the way this BPE will, without renumbering
+        bpe_options counter_options = options;
+        counter_options.token_counts.clear();
+        counter_options.frequency_sample.clear();
+        counter_options.merge_counts.clear();
+        BPE counter(vocab, merges, counter_options);
+        for (uint32_t id : counter.encode(options.frequency_sample)) {
+            if (id >= counts.size())
+                counts.resize(id + 1);
+            counts[id]++;
+        }
     }
-    size_t n = 0;
+    if (!counts.empty()) {
+        // internal ids by descending count, ties keep vocab order
+        counts.resize(max_id + 1);
+        m_external.resize(max_id + 1);
+        for (uint32_t id = 0; id <= max_id; id++) {
+            m_external[id] = id;
+        }
+        std::stable_sort(m_external.begin(), m_external.end(),
+                         [&](uint32_t a, uint32_t b) {
+                             return counts[a] > counts[b];
+                         });
+        m_internal.resize(max_id + 1);
+        for (uint32_t id = 0; id <= max_id; id++) {
+            m_internal[m_external[id]] = id;
+        }
+        for (auto& pair : vocab) {
+            pair.second = m_internal[pair.second];
+        }
+    }
+    m_tokens.assign(max_id + 1, token_info());
+    m_token_bytes.assign(max_id + 1, std::string());
+    // converted to raw bytes once here, so encode and decode never see the
+    // byte alphabet
+    bpe_char_byte_table bs_table;
+    std::unordered_map<std::string, uint32_t> byte_vocab;
+    std::string bytes;
+    for (auto& pair : vocab) {
+        if (alphabet_to_bytes(bs_table, pair.first, bytes)) {
+            byte_vocab[bytes] = pair.second;
+            m_token_bytes[pair.second] = bytes;
+        } else {
+            // not made of bytes, BPE never produces it. decodes as its text
+            m_token_bytes[pair.second] = pair.first;
+        }
+    }
+    // every pretoken starts out as one symbol per byte
+    for (int byte = 0; byte < 256; byte++) {
+        auto loc = byte_vocab.find(std::string(1, (char)byte));
+        m_byte_ids[byte] =
+            loc != byte_vocab.end() ? loc->second : BPE_NO_TOKEN;
+    }
+    m_merges.reserve(merges.size());
+    uint32_t n = 0;
+    std::string left, right;
     for (auto merge : merges) {
         std::string s_merge = merge;
         auto spaceidx = s_merge.find(" ");
-        auto left = icu::UnicodeString::fromUTF8(s_merge.substr(0, spaceidx));
-        auto right = icu::UnicodeString::fromUTF8(s_merge.substr(spaceidx + 1));
-        m_merges[{left, right}] = n++;
+        uint32_t rank = n++;
+        if (!alphabet_to_bytes(bs_table, s_merge.substr(0, spaceidx),
+                               left) ||
+            !alphabet_to_bytes(bs_table, s_merge.substr(spaceidx + 1),
+                               right))
+            continue;
+        auto left_loc = byte_vocab.find(left);
+        auto right_loc = byte_vocab.find(right);
+        auto merged_loc = byte_vocab.find(left + right);
+        // a rule whose parts or result have no id can never apply
+        if (left_loc == byte_vocab.end() || right_loc == byte_vocab.end() ||
+            merged_loc == byte_vocab.end())
+            continue;
+        m_merges.insert(left_loc->second, right_loc->second,
+                        {rank, merged_loc->second});
     }
+    m_rank_count = merges.size();
+    std::vector<std::tuple<uint32_t, uint32_t, merge_entry>> rules;
+    rules.reserve(m_merges.size());
+    m_merges.for_each(
+        [&](uint32_t left, uint32_t right, const merge_entry& value) {
+            rules.emplace_back(left, right, value);
+        });
+    if (!options.merge_counts.empty() && options.hot_merges) {
+        // the most applied rules move to the hot table, so a lookup probes
+        // each table at most once
+        const std::vector<uint64_t>& counts = options.merge_counts;
+        auto count = [&](size_t i) -> uint64_t {
+            uint32_t rank = std::get<2>(rules[i]).rank;
+            return rank < counts.size() ? counts[rank] : 0;
+        };
+        std::vector<size_t> hot;
+        for (size_t i = 0; i < rules.size(); i++) {
+            if (count(i))
+                hot.push_back(i);
+        }
+        size_t keep = std::min(hot.size(), options.hot_merges);
+        std::partial_sort(
+            hot.begin(), hot.begin() + keep, hot.end(),
+            [&](size_t a, size_t b) { return count(a) > count(b); });
+        std::vector<bool> is_hot(rules.size(), false);
+        for (size_t i = 0; i < keep; i++) {
+            is_hot[hot[i]] = true;
+        }
+        flat_map<merge_entry> cold;
+        m_merges_hot.reserve(keep);
+        cold.reserve(rules.size() - keep);
+        for (size_t i = 0; i < rules.size(); i++) {
+            (is_hot[i] ? m_merges_hot : cold)
+                .insert(std::get<0>(rules[i]), std::get<1>(rules[i]),
+                        std::get<2>(rules[i]));
+        }
+        m_merges = std::move(cold);
+    }
+    m_merges_csr.build(std::move(rules));
+    m_byte_pairs.assign(256 * 256, {UINT32_MAX, BPE_NO_TOKEN});
+    for (int left = 0; left < 256; left++) {
+        for (int right = 0; right < 256; right++) {
+            const merge_entry* m =
+                find_merge(m_byte_ids[left], m_byte_ids[right]);
+            if (m)
+                m_byte_pairs[(left << 8) | right] = *m;
+        }
+    }
+    init_tokens(byte_vocab, options.ignore_merges);
+    if (options.seed_characters)
+        init_seeds(byte_vocab);
+    init_run_tables(byte_vocab);
 }
 
-std::vector<uint32_t> BPE::encode(const std::string& input) {
-    auto normalized = normalize_nfc(input);
-    auto pretokenized = pretokenize(normalized);
-    std::vector<icu::UnicodeString> tokens_merged;
-    for (auto ptok : pretokenized) {
-        bpe(ptok, tokens_merged);
+using json = nlohmann::json;
+
+// a setting of a tokenizer.json section, missing if null or absent
+static bool json_flag(const json& j, const char* key, bool missing) {
+    auto it = j.find(key);
+    return it == j.end() || it->is_null() ? missing : it->get<bool>();
+}
+
+static std::string json_string(const json& j, const char* key) {
+    auto it = j.find(key);
+    return it == j.end() || it->is_null() ? std::string()
+                                          : it->get<std::string>();
+}
+
+// the steps of a tokenizer.json stage, a Sequence lists them under key
+static std::vector<json> stage_steps(const json& config,
+                                     const char* stage,
+                                     const char* key) {
+    auto it = config.find(stage);
+    if (it == config.end() || it->is_null())
+        return {};
+    if (it->at("type") == "Sequence")
+        return it->at(key).get<std::vector<json>>();
+    return {*it};
+}
+
+static bpe_options read_pipeline(const json& config, bpe_options options) {
+    const json& model = config.at("model");
+    std::string type = json_string(model, "type");
+    if (!type.empty() && type != "BPE")
+        throw std::runtime_error("tokenizer.json model is not BPE");
+    if (!model.value("dropout", json()).is_null() ||
+        !json_string(model, "continuing_subword_prefix").empty() ||
+        !json_string(model, "end_of_word_suffix").empty() ||
+        json_flag(model, "byte_fallback", false))
+        throw std::runtime_error(
+            "tokenizer.json BPE model uses unsupported settings");
+    options.ignore_merges = json_flag(model, "ignore_merges", false);
+
+    options.normalize = false;
+    for (const json& step : stage_steps(config, "normalizer", "normalizers")) {
+        std::string type = step.at("type");
+        if (type != "NFC")
+            throw std::runtime_error("unsupported tokenizer.json normalizer " +
+                                     type);
+        options.normalize = true;
+    }
+
+    // a regex Split, then ByteLevel to map the bytes. or ByteLevel alone,
+    // splitting with the GPT-2 regex itself
+    options.pretokenizer_regex.clear();
+    options.add_prefix_space = false;
+    bool byte_level = false;
+    for (const json& step :
+         stage_steps(config, "pre_tokenizer", "pretokenizers")) {
+        std::string type = step.at("type");
+        std::string regex;
+        if (type == "Split" && !byte_level) {
+            // Isolated keeps every match and the text between matches as
+            // pretokens, like pretokenize_regex
+            const json& pattern = step.at("pattern");
+            if (step.at("behavior") != "Isolated" ||
+                json_flag(step, "invert", false) || !pattern.contains("Regex"))
+                throw std::runtime_error(
+                    "unsupported tokenizer.json Split pre_tokenizer");
+            regex = pattern.at("Regex");
+        } else if (type == "ByteLevel" && !byte_level) {
+            byte_level = true;
+            if (json_flag(step, "use_regex", true))
+                regex = GPT2_PRETOK_REGEX;
+            // after a Split it would prefix every pretoken
+            options.add_prefix_space =
+                json_flag(step, "add_prefix_space", true);
+            if (options.add_prefix_space && !options.pretokenizer_regex.empty())
+                throw std::runtime_error(
+                    "unsupported tokenizer.json ByteLevel add_prefix_space");
+        } else {
+            throw std::runtime_error(
+                "unsupported tokenizer.json pre_tokenizer " + type);
+        }
+        if (regex.empty())
+            continue;
+        if (!options.pretokenizer_regex.empty())
+            throw std::runtime_error(
+                "tokenizer.json pre_tokenizer splits more than once");
+        options.pretokenizer_regex = regex;
+    }
+    if (!byte_level || options.pretokenizer_regex.empty())
+        throw std::runtime_error(
+            "tokenizer.json pre_tokenizer has to split with a regex and be "
+            "ByteLevel");
+
+    bool byte_decoder = false;
+    for (const json& step : stage_steps(config, "decoder", "decoders")) {
+        std::string type = step.at("type");
+        if (type != "ByteLevel")
+            throw std::runtime_error("unsupported tokenizer.json decoder " +
+                                     type);
+        byte_decoder = true;
+    }
+    if (!byte_decoder)
+        throw std::runtime_error("tokenizer.json decoder has to be ByteLevel");
+    return options;
+}
+
+BPE BPE::from_tokenizer_json(const std::string& json_text,
+                             bpe_options options) {
+    std::unordered_map<std::string, uint32_t> vocab;
+    std::vector<std::string> merges;
+    try {
+        json config = json::parse(json_text);
+        options = read_pipeline(config, options);
+        const json& model = config.at("model");
+        vocab = model.at("vocab")
+                    .get<std::unordered_map<std::string, uint32_t>>();
+        for (const json& merge : model.at("merges")) {
+            // newer files spell a merge as a pair rather than "left right"
+            merges.push_back(merge.is_array()
+                                 ? merge.at(0).get<std::string>() + " " +
+                                       merge.at(1).get<std::string>()
+                                 : merge.get<std::string>());
+        }
+    } catch (const json::exception& e) {
+        throw std::runtime_error(
+            std::string("Reading tokenizer.json failed: ") + e.what());
     }
+    return BPE(std::move(vocab), std::move(merges), options);
+}
+
+std::vector<uint32_t> BPE::encode(const std::string& input) {
+    if (m_add_prefix_space && !input.empty() && input[0] != ' ')
+        return encode(" " + input);
     std::vector<uint32_t> final_tokens;
-    for (auto mtok : tokens_merged) {
-        final_tokens.push_back(m_vocab[mtok]);
+    std::string scratch;
+    if (m_pretokenizer == pretokenizer_kind::regex) {
+        byte_span text = m_normalize ? normalize_nfc(input, scratch) : input;
+        auto pretokenized =
+            pretokenize_regex(text.data() == input.data() ? input : scratch);
+        std::vector<byte_span> spans(pretokenized.begin(), pretokenized.end());
+        merge_pretokens(spans.data(), spans.size(), final_tokens, nullptr);
+    } else {
+        // normalized, pretokenized and merged a chunk at a time, so each
+        // chunk is still in cache for the next stage. only chunks that are
+        // not NFC get copied
+        for (size_t begin = 0; begin < input.size();) {
+            size_t end = pretoken_cut(input.data(), input.size(),
+                                      begin + TEXT_CHUNK);
+            byte_span chunk(input.data() + begin, end - begin);
+            size_t merged = final_tokens.size();
+            if (!merge_text(m_normalize ? normalize_nfc(chunk, scratch) : chunk,
+                            final_tokens)) {
+                // only text that skipped normalizing can be invalid. redone
+                // with U+FFFD in its place, which the regex would see
+                final_tokens.resize(merged);
+                scratch.clear();
+                replace_invalid_utf8(chunk.data(), chunk.size(), scratch);
+                merge_text(scratch, final_tokens);
+            }
+            begin = end;
+        }
+    }
+    trace(final_tokens, 0);
+    to_external(final_tokens, 0);
+    for (auto& tok : final_tokens) {
+        // symbols missing from the vocab encode as 0
+        if (tok == BPE_NO_TOKEN)
+            tok = 0;
     }
     return final_tokens;
 }
@@ -56,122 +400,1139 @@ std::vector<uint32_t> BPE::encode(const std::string& input) {
 std::string BPE::decode(const std::vector<uint32_t>& tokens, bool valid_utf8) {
     std::string out;
     for (uint32_t t : tokens) {
-        icu::UnicodeString benc = m_reverse_vocab[t];
-        icu::StringCharacterIterator schriter(benc);
-        for (UChar32 c = schriter.first32(); schriter.hasNext();
-             c = schriter.next32()) {
-            out.push_back(m_bs_table.codepoint_to_byte((uint32_t)c));
-        }
+        if (t < m_token_bytes.size())
+            out += m_token_bytes[m_internal.empty() ? t : m_internal[t]];
     }
-    // roundtrip through ICU to replace invalid utf8 with U+FFFD
-    if (valid_utf8) {
-        auto tmp = icu::UnicodeString::fromUTF8(out);
-        out.clear();
-        tmp.toUTF8String(out);
+    // replace invalid utf8 with U+FFFD
+    if (valid_utf8 && !is_valid_utf8(out.data(), out.size())) {
+        std::string replaced;
+        replace_invalid_utf8(out.data(), out.size(), replaced);
+        out.swap(replaced);
     }
     return out;
 }
+
 // https://github.com/karpathy/minGPT/blob/37baab71b9abea1b76ab957409a1cc2fbfba8a26/mingpt/bpe.py#L95
-void BPE::bpe(icu::UnicodeString token_pretoked,
-              std::vector<icu::UnicodeString>& output) {
-    if (token_pretoked.length() < 2) {
-        output.push_back(token_pretoked);
+void BPE::encode_pretoken(const std::string& bytes,
+                          std::vector<uint32_t>& output) {
+    size_t begin = output.size();
+    merge_pretoken(bytes, output);
+    trace(output, begin);
+    to_external(output, begin);
+}
+
+void BPE::encode_pretokens(const std::vector<std::string>& pretokens,
+                           std::vector<uint32_t>& output,
+                           std::vector<size_t>& ends) {
+    size_t begin = output.size();
+    std::vector<byte_span> spans(pretokens.begin(), pretokens.end());
+    merge_pretokens(spans.data(), spans.size(), output, &ends);
+    trace(output, begin);
+    to_external(output, begin);
+}
+
+void BPE::to_external(std::vector<uint32_t>& tokens, size_t begin) const {
+    if (m_external.empty())
         return;
+    for (size_t i = begin; i < tokens.size(); i++) {
+        if (tokens[i] != BPE_NO_TOKEN)
+            tokens[i] = m_external[tokens[i]];
     }
-    std::vector<icu::UnicodeString> words;
-    std::vector<icu::UnicodeString> words_update;
-    icu::StringCharacterIterator schriter(token_pretoked);
-    UChar32 c;
-    for (schriter.setToStart(); schriter.hasNext();) {
-        c = schriter.next32PostInc();
-        icu::UnicodeString w;
-        w.append(c);
-        words.push_back(w);
-    }
-    std::unordered_set<UnicodeBigram, bigram_hash> pairs;
-    get_bigrams(words, pairs);
-    while (true) {
-        size_t min_rank = SIZE_MAX;
-        UnicodeBigram to_merge;
-        for (auto bigram : pairs) {
-            auto loc = m_merges.find(bigram);
-            if (loc != m_merges.end() && loc->second < min_rank) {
-                min_rank = loc->second;
-                to_merge = loc->first;
+}
+
+void BPE::set_merge_trace(bool on) {
+    if (on)
+        m_merge_trace.assign(m_rank_count, 0);
+    m_tracing = on;
+}
+
+void BPE::trace(const std::vector<uint32_t>& tokens, size_t begin) {
+    if (!m_tracing)
+        return;
+    // a token in BPE output was built by the same merges as BPE of its own
+    // bytes, which split_token recorded as a tree of rules
+    std::vector<uint32_t> stack;
+    for (size_t i = begin; i < tokens.size(); i++) {
+        if (tokens[i] == BPE_NO_TOKEN)
+            continue;
+        stack.push_back(tokens[i]);
+        while (!stack.empty()) {
+            const token_info& t = m_tokens[stack.back()];
+            stack.pop_back();
+            // tokens merges do not build only come from ignore_merges
+            if (t.rank == BPE_NO_TOKEN || !t.valid)
+                continue;
+            m_merge_trace[t.rank]++;
+            stack.push_back(t.left);
+            stack.push_back(t.right);
+        }
+    }
+}
+
+bool BPE::merge_text(byte_span text, std::vector<uint32_t>& output) {
+    // merged a window at a time as the scanner finds them, so only the
+    // spans of one window exist at once
+    pretoken_scanner scanner(m_pretokenizer, text.data(), text.size());
+    byte_span window[PRETOKEN_WINDOW];
+    size_t count;
+    do {
+        count = 0;
+        while (count < PRETOKEN_WINDOW && scanner.next(window[count])) {
+            count++;
+        }
+        merge_pretokens(window, count, output, nullptr);
+    } while (count == PRETOKEN_WINDOW);
+    return !scanner.invalid();
+}
+
+void BPE::merge_pretoken(byte_span bytes, std::vector<uint32_t>& output) {
+    if (m_max_pretoken_bytes && bytes.size() > m_max_pretoken_bytes) {
+        for (size_t begin = 0; begin < bytes.size();) {
+            size_t end = begin + m_max_pretoken_bytes;
+            if (end >= bytes.size()) {
+                end = bytes.size();
+            } else {
+                // back to the lead byte of the character the cut falls
+                // into. invalid UTF-8 without one in reach is cut as is
+                auto trail = [&](size_t i) {
+                    return ((uint8_t)bytes[i] & 0xc0) == 0x80;
+                };
+                size_t cut = end;
+                while (cut > end - 3 && trail(cut)) {
+                    cut--;
+                }
+                if (!trail(cut))
+                    end = cut;
+            }
+            merge_pretoken(byte_span(bytes.data() + begin, end - begin),
+                           output);
+            begin = end;
+        }
+        return;
+    }
+    // pretokens that are a token BPE leaves alone need no merging
+    uint32_t self = find_self_token(bytes);
+    if (self != BPE_NO_TOKEN) {
+        output.push_back(self);
+        return;
+    }
+    if (merge_run(bytes, output))
+        return;
+    bpe_engine engine = m_engine;
+    if (engine == bpe_engine::adaptive) {
+        if (bytes.size() <= m_thresholds.naive_max)
+            engine = bpe_engine::naive;
+        else if (bytes.size() <= m_thresholds.rank_array_max)
+            engine = bpe_engine::rank_array;
+        else
+            engine = bpe_engine::backtrack;
+    }
+    switch (engine) {
+        case bpe_engine::naive:
+            bpe_naive(bytes, output);
+            break;
+        case bpe_engine::heap:
+            bpe_heap(bytes, output);
+            break;
+        case bpe_engine::rank_array:
+        case bpe_engine::adaptive:
+            bpe_rank_array(bytes, output);
+            break;
+        case bpe_engine::backtrack:
+            // bytes without a token take the merge loop instead
+            if (!bpe_backtrack(bytes, output))
+                bpe_heap(bytes, output);
+            break;
+    }
+}
+
+void BPE::merge_pretokens(const byte_span* pretokens,
+                          size_t count,
+                          std::vector<uint32_t>& output,
+                          std::vector<size_t>* ends) {
+    size_t lanes_max = 0;
+#if defined(__AVX2__)
+    if (m_engine == bpe_engine::adaptive &&
+        m_merge_lookup == merge_lookup::hashed)
+        lanes_max = std::min(m_thresholds.lanes_max, (size_t)LANE_BYTES);
+    // longer ones get cut first
+    if (m_max_pretoken_bytes)
+        lanes_max = std::min(lanes_max, m_max_pretoken_bytes);
+#endif
+    if (!lanes_max) {
+        for (size_t i = 0; i < count; i++) {
+            merge_pretoken(pretokens[i], output);
+            if (ends)
+                ends->push_back(output.size());
+        }
+        return;
+    }
+    // pretokens go through the lanes a window at a time and are then
+    // emitted in order, taking the rest through merge_pretoken
+    static thread_local std::vector<uint32_t> lane_out(PRETOKEN_WINDOW *
+                                                       LANE_BYTES);
+    // 0 for pretokens the lanes did not take
+    static thread_local std::vector<uint8_t> lane_lens(PRETOKEN_WINDOW);
+    for (size_t begin = 0; begin < count; begin += PRETOKEN_WINDOW) {
+        size_t end = std::min(begin + PRETOKEN_WINDOW, count);
+        byte_span words[8];
+        size_t slots[8];
+        size_t lanes = 0;
+        alignas(32) uint32_t batch_out[8 * LANE_BYTES];
+        uint8_t batch_lens[8];
+        auto flush = [&]() {
+            bpe_lanes(words, lanes, batch_out, batch_lens);
+            for (size_t lane = 0; lane < lanes; lane++) {
+                std::copy(batch_out + lane * LANE_BYTES,
+                          batch_out + lane * LANE_BYTES + batch_lens[lane],
+                          &lane_out[slots[lane] * LANE_BYTES]);
+                lane_lens[slots[lane]] = batch_lens[lane];
+            }
+            lanes = 0;
+        };
+        for (size_t i = begin; i < end; i++) {
+            byte_span ptok = pretokens[i];
+            lane_lens[i - begin] = 0;
+            if (!ptok.size() || ptok.size() > lanes_max)
+                continue;
+            uint32_t self = find_self_token(ptok);
+            if (self != BPE_NO_TOKEN) {
+                lane_out[(i - begin) * LANE_BYTES] = self;
+                lane_lens[i - begin] = 1;
+                continue;
+            }
+            words[lanes] = ptok;
+            slots[lanes] = i - begin;
+            if (++lanes == 8)
+                flush();
+        }
+        if (lanes)
+            flush();
+        for (size_t i = begin; i < end; i++) {
+            uint8_t len = lane_lens[i - begin];
+            if (len) {
+                output.insert(output.end(), &lane_out[(i - begin) * LANE_BYTES],
+                              &lane_out[(i - begin) * LANE_BYTES] + len);
+            } else {
+                merge_pretoken(pretokens[i], output);
+            }
+            if (ends)
+                ends->push_back(output.size());
+        }
+    }
+}
+
+void BPE::bpe_naive(byte_span bytes, std::vector<uint32_t>& output) {
+    std::vector<uint32_t> words;
+    std::vector<const merge_entry*> pairs;
+    bool seeded = seed(bytes, words, pairs);
+    // before the first merge every pair is a pair of bytes, or its rule
+    // came with the seeds
+    bool first_round = true;
+    while (words.size() >= 2) {
+        merge_entry to_merge = {UINT32_MAX, BPE_NO_TOKEN};
+        uint32_t left = 0, right = 0;
+        for (size_t i = 0; i + 1 < words.size(); i++) {
+            const merge_entry* m =
+                !first_round ? find_merge(words[i], words[i + 1])
+                : seeded     ? pairs[i]
+                             : &find_byte_pair(bytes[i], bytes[i + 1]);
+            if (m && m->rank < to_merge.rank) {
+                to_merge = *m;
+                left = words[i];
+                right = words[i + 1];
+            }
+        }
+        if (to_merge.rank == UINT32_MAX)
+            break;
+        first_round = false;
+        // merge every occurrence of the pair, left to right, in place
+        size_t out = 0;
+        for (size_t i = 0; i < words.size(); i++) {
+            if (words[i] == left && i + 1 < words.size() &&
+                words[i + 1] == right) {
+                words[out++] = to_merge.id;
+                i++;
+            } else {
+                words[out++] = words[i];
+            }
+        }
+        words.resize(out);
+    }
+    output.insert(output.end(), words.begin(), words.end());
+}
+
+namespace {
+struct heap_symbol {
+    uint32_t id;
+    int32_t prev;
+    int32_t next;
+};
+
+struct heap_pair {
+    // rank in the high half, position of the left symbol in the low half,
+    // so equal ranks pop left to right like the naive engine merges them
+    uint64_t order;
+    uint32_t left;
+    uint32_t right;
+    uint32_t merged;
+
+    bool operator>(const heap_pair& other) const {
+        return order > other.order;
+    }
+};
+}  // namespace
+
+void BPE::bpe_heap(byte_span bytes, std::vector<uint32_t>& output) {
+    std::vector<uint32_t> ids;
+    std::vector<const merge_entry*> pairs;
+    bool seeded = seed(bytes, ids, pairs);
+    if (ids.size() < 2) {
+        output.insert(output.end(), ids.begin(), ids.end());
+        return;
+    }
+    std::vector<heap_symbol> symbols(ids.size());
+    for (size_t i = 0; i < ids.size(); i++) {
+        symbols[i] = {ids[i], (int32_t)i - 1, (int32_t)i + 1};
+    }
+    symbols.back().next = -1;
+    std::vector<heap_pair> storage;
+    storage.reserve(ids.size());
+    std::priority_queue<heap_pair, std::vector<heap_pair>,
+                        std::greater<heap_pair>>
+        queue(std::greater<heap_pair>(), std::move(storage));
+    auto push_pair = [&](int32_t pos, const merge_entry* m) {
+        if (m && m->rank != UINT32_MAX) {
+            queue.push({((uint64_t)m->rank << 32) | (uint32_t)pos,
+                        symbols[pos].id, symbols[symbols[pos].next].id,
+                        m->id});
+        }
+    };
+    auto push_merged = [&](int32_t pos) {
+        if (pos >= 0 && symbols[pos].next >= 0)
+            push_pair(pos, find_merge(symbols[pos].id,
+                                      symbols[symbols[pos].next].id));
+    };
+    // the initial pairs are all pairs of bytes, or their rules came with
+    // the seeds
+    for (size_t i = 0; i + 1 < ids.size(); i++) {
+        push_pair((int32_t)i, seeded ? pairs[i]
+                                     : &find_byte_pair(bytes[i], bytes[i + 1]));
+    }
+    while (!queue.empty()) {
+        heap_pair top = queue.top();
+        queue.pop();
+        int32_t pos = (int32_t)(top.order & 0xffffffff);
+        heap_symbol& sym = symbols[pos];
+        // entries are never removed, skip those a previous merge made stale
+        if (sym.id != top.left || sym.next < 0 ||
+            symbols[sym.next].id != top.right)
+            continue;
+        heap_symbol& next = symbols[sym.next];
+        sym.id = top.merged;
+        sym.next = next.next;
+        if (next.next >= 0)
+            symbols[next.next].prev = pos;
+        next.id = BPE_NO_TOKEN;
+        push_merged(sym.prev);
+        push_merged(pos);
+    }
+    for (int32_t pos = 0; pos >= 0; pos = symbols[pos].next) {
+        output.push_back(symbols[pos].id);
+    }
+}
+
+// rank of a pair without a rule in the rank array engine. ranks stay below
+// 2^31 so they also compare correctly as signed lanes
+static const uint32_t NO_RANK = INT32_MAX;
+// lanes of the widest vector argmin, the rank array is padded to a multiple
+static const size_t RANK_LANES = 8;
+
+// index of the first lowest of ranks[0, n), n a multiple of RANK_LANES
+static size_t rank_argmin(const uint32_t* ranks, size_t n) {
+#if defined(__AVX2__)
+    __m256i lowest = _mm256_set1_epi32((int)NO_RANK);
+    for (size_t i = 0; i < n; i += 8) {
+        lowest = _mm256_min_epi32(
+            lowest, _mm256_loadu_si256((const __m256i*)(ranks + i)));
+    }
+    __m128i low = _mm_min_epi32(_mm256_castsi256_si128(lowest),
+                                _mm256_extracti128_si256(lowest, 1));
+    low = _mm_min_epi32(low, _mm_shuffle_epi32(low, _MM_SHUFFLE(1, 0, 3, 2)));
+    low = _mm_min_epi32(low, _mm_shuffle_epi32(low, _MM_SHUFFLE(2, 3, 0, 1)));
+    __m256i needle = _mm256_broadcastd_epi32(low);
+    for (size_t i = 0;; i += 8) {
+        __m256i eq = _mm256_cmpeq_epi32(
+            needle, _mm256_loadu_si256((const __m256i*)(ranks + i)));
+        uint32_t mask = (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(eq));
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+#elif defined(__SSE2__)
+    __m128i lowest = _mm_set1_epi32((int)NO_RANK);
+    for (size_t i = 0; i < n; i += 4) {
+        __m128i block = _mm_loadu_si128((const __m128i*)(ranks + i));
+        __m128i less = _mm_cmplt_epi32(block, lowest);
+        lowest = _mm_or_si128(_mm_and_si128(less, block),
+                              _mm_andnot_si128(less, lowest));
+    }
+    alignas(16) uint32_t lanes[4];
+    _mm_store_si128((__m128i*)lanes, lowest);
+    uint32_t low = std::min(std::min(lanes[0], lanes[1]),
+                            std::min(lanes[2], lanes[3]));
+    __m128i needle = _mm_set1_epi32((int)low);
+    for (size_t i = 0;; i += 4) {
+        __m128i eq = _mm_cmpeq_epi32(
+            needle, _mm_loadu_si128((const __m128i*)(ranks + i)));
+        uint32_t mask = (uint32_t)_mm_movemask_ps(_mm_castsi128_ps(eq));
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+#else
+    size_t lowest = 0;
+    for (size_t i = 1; i < n; i++) {
+        if (ranks[i] < ranks[lowest])
+            lowest = i;
+    }
+    return lowest;
+#endif
+}
+
+// https://github.com/openai/tiktoken/blob/main/src/lib.rs, _byte_pair_merge
+void BPE::bpe_rank_array(byte_span bytes, std::vector<uint32_t>& output) {
+    // reused between calls so short pretokens do not allocate
+    static thread_local std::vector<uint32_t> ids;
+    static thread_local std::vector<uint32_t> ranks;
+    static thread_local std::vector<const merge_entry*> pairs;
+    bool seeded = seed(bytes, ids, pairs);
+    size_t n = ids.size();
+    size_t padded = (n + RANK_LANES - 1) / RANK_LANES * RANK_LANES;
+    ranks.assign(padded, NO_RANK);
+    for (size_t i = 0; i + 1 < n; i++) {
+        const merge_entry* m =
+            seeded ? pairs[i] : &find_byte_pair(bytes[i], bytes[i + 1]);
+        if (m && m->rank != UINT32_MAX)
+            ranks[i] = m->rank;
+    }
+    auto rank_at = [&](size_t i) {
+        const merge_entry* m = find_merge(ids[i], ids[i + 1]);
+        return m ? m->rank : NO_RANK;
+    };
+    while (n >= 2) {
+        size_t i = rank_argmin(ranks.data(), padded);
+        if (ranks[i] == NO_RANK)
+            break;
+        ids[i] = find_merge(ids[i], ids[i + 1])->id;
+        // drop part i + 1, the padding past the end stays NO_RANK
+        std::copy(ids.begin() + i + 2, ids.begin() + n, ids.begin() + i + 1);
+        std::copy(ranks.begin() + i + 2, ranks.begin() + n,
+                  ranks.begin() + i + 1);
+        n--;
+        ranks[n] = NO_RANK;
+        ranks[n - 1] = NO_RANK;
+        if (i + 1 < n)
+            ranks[i] = rank_at(i);
+        if (i > 0)
+            ranks[i - 1] = rank_at(i - 1);
+    }
+    output.insert(output.end(), ids.begin(), ids.begin() + n);
+}
+
+// the rank array engine run on 8 pretokens at once, one per vector lane.
+// every step each lane merges its lowest ranked pair, and the two rules
+// next to the new token are looked up with gathers into the merge tables
+void BPE::bpe_lanes(const byte_span* words,
+                    size_t count,
+                    uint32_t* out,
+                    uint8_t* lens) {
+#if defined(__AVX2__)
+    // position-major, so row p holds position p of every lane. the spare
+    // row past the longest pretoken reads as no token
+    alignas(32) uint32_t ids[LANE_BYTES + 1][8];
+    alignas(32) uint32_t ranks[LANE_BYTES + 1][8];
+    alignas(32) uint32_t merged[LANE_BYTES + 1][8];
+    alignas(32) uint32_t len[8];
+    size_t rows = 0;
+    for (size_t lane = 0; lane < 8; lane++) {
+        len[lane] = lane < count ? (uint32_t)words[lane].size() : 0;
+        rows = std::max<size_t>(rows, len[lane]);
+    }
+    for (size_t lane = 0; lane < 8; lane++) {
+        const char* bytes = lane < count ? words[lane].data() : nullptr;
+        for (size_t p = 0; p <= rows; p++) {
+            ids[p][lane] = p < len[lane] ? m_byte_ids[(uint8_t)bytes[p]]
+                                         : BPE_NO_TOKEN;
+            ranks[p][lane] = NO_RANK;
+            merged[p][lane] = BPE_NO_TOKEN;
+            if (p + 1 < len[lane]) {
+                const merge_entry& m = find_byte_pair(bytes[p], bytes[p + 1]);
+                if (m.rank != UINT32_MAX) {
+                    ranks[p][lane] = m.rank;
+                    merged[p][lane] = m.id;
+                }
+            }
+        }
+    }
+    const __m256i no_rank = _mm256_set1_epi32((int)NO_RANK);
+    const __m256i no_token = _mm256_set1_epi32(-1);
+    const __m256i row = _mm256_set1_epi32(8);
+    const __m256i lane_index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i lane_len = _mm256_load_si256((const __m256i*)len);
+    const int* id_base = (const int*)&ids[0][0];
+    for (;;) {
+        // leftmost lowest rank of each lane
+        __m256i best = no_rank;
+        __m256i at = _mm256_setzero_si256();
+        for (size_t p = 0; p + 1 < rows; p++) {
+            __m256i rank = _mm256_load_si256((const __m256i*)ranks[p]);
+            __m256i lower = _mm256_cmpgt_epi32(best, rank);
+            best = _mm256_blendv_epi8(best, rank, lower);
+            at = _mm256_blendv_epi8(at, _mm256_set1_epi32((int)p), lower);
+        }
+        __m256i active = _mm256_cmpgt_epi32(no_rank, best);
+        if (_mm256_testz_si256(active, active))
+            break;
+        lane_len = _mm256_add_epi32(lane_len, active);
+        __m256i idx = _mm256_add_epi32(_mm256_slli_epi32(at, 3), lane_index);
+        __m256i id = _mm256_mask_i32gather_epi32(
+            no_token, (const int*)&merged[0][0], idx, active, 4);
+        // position at takes the new token, the ones after it move down
+        for (size_t p = 0; p < rows; p++) {
+            __m256i pos = _mm256_set1_epi32((int)p);
+            __m256i here = _mm256_and_si256(active, _mm256_cmpeq_epi32(at, pos));
+            __m256i after = _mm256_and_si256(active, _mm256_cmpgt_epi32(pos, at));
+            __m256i* id_row = (__m256i*)ids[p];
+            __m256i* rank_row = (__m256i*)ranks[p];
+            __m256i* merged_row = (__m256i*)merged[p];
+            _mm256_store_si256(
+                id_row,
+                _mm256_blendv_epi8(
+                    _mm256_blendv_epi8(_mm256_load_si256(id_row),
+                                       _mm256_load_si256(id_row + 1), after),
+                    id, here));
+            _mm256_store_si256(
+                rank_row,
+                _mm256_blendv_epi8(_mm256_load_si256(rank_row),
+                                   _mm256_load_si256(rank_row + 1), after));
+            _mm256_store_si256(
+                merged_row,
+                _mm256_blendv_epi8(_mm256_load_si256(merged_row),
+                                   _mm256_load_si256(merged_row + 1), after));
+        }
+        // the rules joining the new token with its neighbours
+        __m256i right = _mm256_i32gather_epi32(
+            id_base, _mm256_add_epi32(idx, row), 4);
+        __m256i has_left =
+            _mm256_and_si256(active, _mm256_cmpgt_epi32(at, _mm256_setzero_si256()));
+        __m256i left = _mm256_mask_i32gather_epi32(
+            no_token, id_base, _mm256_sub_epi32(idx, row), has_left, 4);
+        // a rule is in one of the two tables, so at most one hits
+        __m256i right_rank = no_rank, right_id = no_token;
+        m_merges_hot.find8(id, right, right_rank, right_id);
+        m_merges.find8(id, right, right_rank, right_id);
+        __m256i left_rank = no_rank, left_id = no_token;
+        m_merges_hot.find8(left, id, left_rank, left_id);
+        m_merges.find8(left, id, left_rank, left_id);
+        for (size_t p = 0; p + 1 < rows; p++) {
+            __m256i pos = _mm256_set1_epi32((int)p);
+            __m256i is_right =
+                _mm256_and_si256(active, _mm256_cmpeq_epi32(at, pos));
+            __m256i is_left = _mm256_and_si256(
+                has_left,
+                _mm256_cmpeq_epi32(at, _mm256_set1_epi32((int)p + 1)));
+            __m256i* rank_row = (__m256i*)ranks[p];
+            __m256i* merged_row = (__m256i*)merged[p];
+            _mm256_store_si256(
+                rank_row,
+                _mm256_blendv_epi8(
+                    _mm256_blendv_epi8(_mm256_load_si256(rank_row),
+                                       right_rank, is_right),
+                    left_rank, is_left));
+            _mm256_store_si256(
+                merged_row,
+                _mm256_blendv_epi8(
+                    _mm256_blendv_epi8(_mm256_load_si256(merged_row),
+                                       right_id, is_right),
+                    left_id, is_left));
+        }
+    }
+    _mm256_store_si256((__m256i*)len, lane_len);
+    for (size_t lane = 0; lane < count; lane++) {
+        lens[lane] = (uint8_t)len[lane];
+        for (size_t p = 0; p < len[lane]; p++) {
+            out[lane * LANE_BYTES + p] = ids[p][lane];
+        }
+    }
+#else
+    // only called from AVX2 builds
+    (void)words;
+    (void)count;
+    (void)out;
+    (void)lens;
+#endif
+}
+
+void token_trie::build(
+    const std::vector<std::pair<std::string, uint32_t>>& tokens) {
+    // inserting in sorted order appends every node's children in byte
+    // order, so they can be flattened as they are
+    std::vector<std::pair<std::string, uint32_t>> sorted(tokens);
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<std::vector<std::pair<uint8_t, uint32_t>>> children(1);
+    m_node_token.assign(1, BPE_NO_TOKEN);
+    for (auto& tok : sorted) {
+        uint32_t node = 0;
+        for (char c : tok.first) {
+            auto& edges = children[node];
+            if (edges.empty() || edges.back().first != (uint8_t)c) {
+                edges.push_back({(uint8_t)c, (uint32_t)children.size()});
+                children.emplace_back();
+                m_node_token.push_back(BPE_NO_TOKEN);
             }
+            node = children[node].back().second;
+        }
+        m_node_token[node] = tok.second;
+    }
+    m_first_edge.clear();
+    m_edge_byte.clear();
+    m_edge_node.clear();
+    for (auto& edges : children) {
+        m_first_edge.push_back((uint32_t)m_edge_byte.size());
+        for (auto& edge : edges) {
+            m_edge_byte.push_back(edge.first);
+            m_edge_node.push_back(edge.second);
         }
-        if (min_rank == SIZE_MAX) {
+    }
+    m_first_edge.push_back((uint32_t)m_edge_byte.size());
+    for (int byte = 0; byte < 256; byte++) {
+        m_root_child[byte] = BPE_NO_TOKEN;
+    }
+    for (auto& edge : children[0]) {
+        m_root_child[edge.first] = edge.second;
+    }
+}
+
+uint32_t token_trie::child(uint32_t node, uint8_t byte) const {
+    auto first = m_edge_byte.begin() + m_first_edge[node];
+    auto last = m_edge_byte.begin() + m_first_edge[node + 1];
+    auto loc = std::lower_bound(first, last, byte);
+    if (loc == last || *loc != byte)
+        return BPE_NO_TOKEN;
+    return m_edge_node[loc - m_edge_byte.begin()];
+}
+
+uint32_t token_trie::longest_prefix(const char* s, size_t len) const {
+    if (len == 0)
+        return BPE_NO_TOKEN;
+    uint32_t node = m_root_child[(uint8_t)s[0]];
+    uint32_t found = BPE_NO_TOKEN;
+    for (size_t i = 1; node != BPE_NO_TOKEN; i++) {
+        if (m_node_token[node] != BPE_NO_TOKEN)
+            found = m_node_token[node];
+        if (i == len)
             break;
+        node = child(node, (uint8_t)s[i]);
+    }
+    return found;
+}
+
+void BPE::init_tokens(
+    const std::unordered_map<std::string, uint32_t>& byte_vocab,
+    bool ignore_merges) {
+    std::vector<std::pair<std::string, uint32_t>> valid;
+    std::vector<std::pair<std::string, uint32_t>> unreachable;
+    for (auto& tok : byte_vocab) {
+        if (tok.first.empty())
+            continue;
+        m_tokens[tok.second].len = (uint32_t)tok.first.size();
+        if (split_token(tok.second, tok.first))
+            valid.push_back(tok);
+        else if (ignore_merges)
+            unreachable.push_back(tok);
+    }
+    m_trie.build(valid);
+    for (auto& tok : valid) {
+        // the longest match of the token minus its last byte
+        m_tokens[tok.second].next_prefix =
+            m_trie.longest_prefix(tok.first.data(), tok.first.size() - 1);
+    }
+    auto add_self_token = [&](const std::string& bytes, uint32_t id) {
+        if (bytes.size() < 8) {
+            uint64_t key = short_key(bytes.data(), bytes.size());
+            m_self_tokens_short.insert((uint32_t)key, (uint32_t)(key >> 32),
+                                       id);
         } else {
-            auto i = words.begin();
-            while (i < words.end()) {
-                if (*i == to_merge.first) {
-                    auto inext = i;
-                    inext++;
-                    if (inext != words.end() && *inext == to_merge.second) {
-                        words_update.push_back(*i + *inext);
-                        i = inext;
-                    } else {
-                        words_update.push_back(*i);
+            uint64_t h = hash_bytes(bytes.data(), bytes.size());
+            m_self_tokens_long.insert((uint32_t)h, (uint32_t)(h >> 32), id);
+        }
+    };
+    for (auto& tok : valid) {
+        add_self_token(tok.first, tok.second);
+    }
+    // with ignore_merges, pretokens equal to these still become them
+    for (auto& tok : unreachable) {
+        add_self_token(tok.first, tok.second);
+    }
+}
+
+uint32_t BPE::find_self_token(byte_span bytes) const {
+    size_t len = bytes.size();
+    const uint32_t* id;
+    if (len < 8) {
+        uint64_t key = short_key(bytes.data(), len);
+        id = m_self_tokens_short.find((uint32_t)key, (uint32_t)(key >> 32));
+        if (id)
+            return *id;
+    } else {
+        uint64_t h = hash_bytes(bytes.data(), len);
+        id = m_self_tokens_long.find((uint32_t)h, (uint32_t)(h >> 32));
+        if (id && m_token_bytes[*id].size() == len &&
+            std::equal(bytes.begin(), bytes.end(), m_token_bytes[*id].begin()))
+            return *id;
+    }
+    return BPE_NO_TOKEN;
+}
+
+void BPE::init_seeds(
+    const std::unordered_map<std::string, uint32_t>& byte_vocab) {
+    // lowest rank of a rule with each id on its left and on its right
+    std::vector<uint32_t> first_left(m_tokens.size(), UINT32_MAX);
+    std::vector<uint32_t> first_right(m_tokens.size(), UINT32_MAX);
+    for_each_merge(
+        [&](uint32_t left, uint32_t right, const merge_entry& value) {
+            first_left[left] = std::min(first_left[left], value.rank);
+            first_right[right] = std::min(first_right[right], value.rank);
+        });
+    std::unordered_set<int32_t> seen;
+    std::vector<std::pair<int32_t, uint32_t>> seeds;
+    for (auto& tok : byte_vocab) {
+        const std::string& s = tok.first;
+        for (int32_t i = 0, len = (int32_t)s.size(); i < len;) {
+            int32_t start = i;
+            int32_t c = utf8_next(s.data(), i, len);
+            if (c < 0x80 || !seen.insert(c).second)
+                continue;
+            std::vector<uint32_t> words;
+            for (int32_t k = start; k < i; k++) {
+                words.push_back(m_byte_ids[(uint8_t)s[k]]);
+            }
+            if (std::count(words.begin(), words.end(), BPE_NO_TOKEN))
+                continue;
+            // the merge loop on the character alone, minding the highest
+            // rank it applies and the lowest of a rule reaching outside
+            uint32_t last = 0;
+            uint32_t outside = UINT32_MAX;
+            while (true) {
+                outside = std::min({outside, first_right[words.front()],
+                                    first_left[words.back()]});
+                const merge_entry* to_merge = nullptr;
+                size_t at = 0;
+                for (size_t k = 0; k + 1 < words.size(); k++) {
+                    const merge_entry* m = find_merge(words[k], words[k + 1]);
+                    if (m && (!to_merge || m->rank < to_merge->rank)) {
+                        to_merge = m;
+                        at = k;
                     }
-                } else {
-                    words_update.push_back(*i);
                 }
-                ++i;
+                if (!to_merge)
+                    break;
+                last = std::max(last, to_merge->rank);
+                words[at] = to_merge->id;
+                words.erase(words.begin() + at + 1);
             }
-            words.swap(words_update);
-            words_update.clear();
-            get_bigrams(words, pairs);
+            if (words.size() == (size_t)(i - start) || last >= outside)
+                continue;
+            seeds.emplace_back(c, (uint32_t)m_seed_tokens.size() << 2 |
+                                      (uint32_t)(words.size() - 1));
+            m_seed_tokens.insert(m_seed_tokens.end(), words.begin(),
+                                 words.end());
         }
     }
-    output.insert(output.end(), words.begin(), words.end());
+    if (seeds.empty())
+        return;
+    const uint32_t block_size = 1 << SEED_BLOCK_SHIFT;
+    m_seed_data.assign(block_size, (uint32_t)NO_SEED);
+    for (auto& seed : seeds) {
+        size_t block = (size_t)seed.first >> SEED_BLOCK_SHIFT;
+        if (block >= m_seed_blocks.size())
+            m_seed_blocks.resize(block + 1, 0);
+        if (!m_seed_blocks[block]) {
+            m_seed_blocks[block] = (uint32_t)(m_seed_data.size() / block_size);
+            m_seed_data.resize(m_seed_data.size() + block_size,
+                               (uint32_t)NO_SEED);
+        }
+        m_seed_data[m_seed_blocks[block] << SEED_BLOCK_SHIFT |
+                    (seed.first & (block_size - 1))] = seed.second;
+    }
 }
 
-std::string BPE::normalize_nfc(const std::string& input) {
-    UErrorCode uerror = U_ZERO_ERROR;
-    auto nfcnorm = icu::Normalizer2::getNFCInstance(uerror);
-    if (!U_SUCCESS(uerror))
-        throw std::runtime_error("could not get ICU NFC normalizer");
-    auto icu_ti = icu::UnicodeString::fromUTF8(input);
-    std::string out;
-    nfcnorm->normalize(icu_ti, uerror).toUTF8String(out);
-    if (!U_SUCCESS(uerror))
-        throw std::runtime_error("ICU string normalization failed");
-    return out;
+bool BPE::seed(byte_span bytes,
+               std::vector<uint32_t>& ids,
+               std::vector<const merge_entry*>& pairs) const {
+    ids.clear();
+    const char* s = bytes.data();
+    int32_t len = (int32_t)bytes.size();
+    // the first character with a seed, without one it is all bytes
+    int32_t first =
+        m_seed_blocks.empty() ? len : (int32_t)ascii_prefix_end(s, len);
+    while (first < len) {
+        int32_t next = first;
+        int32_t c = utf8_next(s, next, len);
+        if (c >= 0x80 && find_seed(c) != NO_SEED)
+            break;
+        first = next;
+    }
+    if (first == len) {
+        for (char c : bytes) {
+            ids.push_back(m_byte_ids[(uint8_t)c]);
+        }
+        return false;
+    }
+    pairs.clear();
+    for (int32_t k = 0; k < first; k++) {
+        if (k)
+            pairs.push_back(&find_byte_pair(s[k - 1], s[k]));
+        ids.push_back(m_byte_ids[(uint8_t)s[k]]);
+    }
+    // whether ids.back() is the token of byte s[start - 1], which s[first]
+    // having a seed leaves false until there is one
+    bool after_byte = false;
+    for (int32_t i = first; i < len;) {
+        int32_t start = i;
+        int32_t c = utf8_next(s, i, len);
+        uint32_t found = c >= 0x80 ? find_seed(c) : NO_SEED;
+        if (found == NO_SEED) {
+            for (int32_t k = start; k < i; k++) {
+                uint8_t b = (uint8_t)s[k];
+                if (after_byte)
+                    pairs.push_back(&find_byte_pair(s[k - 1], s[k]));
+                else
+                    pairs.push_back(find_merge(ids.back(), m_byte_ids[b]));
+                ids.push_back(m_byte_ids[b]);
+                after_byte = true;
+            }
+            continue;
+        }
+        const uint32_t* tokens = &m_seed_tokens[found >> 2];
+        for (size_t k = 0; k <= (found & 3); k++) {
+            if (!ids.empty())
+                pairs.push_back(find_merge(ids.back(), tokens[k]));
+            ids.push_back(tokens[k]);
+        }
+        after_byte = false;
+    }
+    return true;
 }
 
-std::vector<icu::UnicodeString> BPE::pretokenize(const std::string& input) {
-    UParseError pe;
+void BPE::init_run_tables(
+    const std::unordered_map<std::string, uint32_t>& byte_vocab) {
+    // length of the longest token of each lead byte << 8 | run byte, with
+    // the lead equal to the run byte for the tokens that are a run
+    std::unordered_map<uint32_t, size_t> longest;
+    for (auto& tok : byte_vocab) {
+        const std::string& s = tok.first;
+        if (s.size() < 2)
+            continue;
+        uint8_t run = (uint8_t)s[1];
+        if (std::all_of(s.begin() + 2, s.end(),
+                        [&](char c) { return (uint8_t)c == run; })) {
+            size_t& len = longest[(uint8_t)s[0] << 8 | run];
+            len = std::max(len, s.size());
+        }
+    }
+    // merges runs of growing length until every length for twice the
+    // longest token has been the run one period shorter plus a period
+    // token, after which the tokens at the far end can no longer reach
+    // back to the start of the run
+    auto build = [&](int lead, uint8_t run, size_t longest_token) {
+        run_table table;
+        table.head = lead >= 0;
+        std::string bytes;
+        if (lead >= 0)
+            bytes += (char)lead;
+        uint32_t streak_token = BPE_NO_TOKEN;
+        size_t streak = 0;
+        for (size_t n = 0; n <= 4 * longest_token + 64; n++) {
+            if (n)
+                bytes += (char)run;
+            size_t begin = table.tokens.size();
+            table.starts.push_back(begin);
+            if (!bpe_backtrack(bytes, table.tokens))
+                bpe_heap(bytes, table.tokens);
+            size_t count = table.tokens.size() - begin;
+            if (count <= table.head) {
+                streak = 0;
+                continue;
+            }
+            const uint32_t* tokens = &table.tokens[begin];
+            uint32_t token = tokens[table.head];
+            // a run byte without a token never settles
+            size_t period = token != BPE_NO_TOKEN ? m_tokens[token].len : 0;
+            bool repeats = false;
+            if (period && period <= n) {
+                const uint32_t* shorter =
+                    &table.tokens[table.starts[n - period]];
+                repeats = table.starts[n - period + 1] -
+                                  table.starts[n - period] + 1 ==
+                              count &&
+                          std::equal(tokens, tokens + table.head, shorter) &&
+                          std::equal(tokens + table.head + 1, tokens + count,
+                                     shorter + table.head);
+            }
+            streak = !repeats ? 0 : token == streak_token ? streak + 1 : 1;
+            streak_token = token;
+            if (streak >= 2 * longest_token) {
+                table.period_from = n - streak + 1;
+                table.period = period;
+                table.period_token = token;
+                // only the lengths below period_from are kept
+                table.starts.resize(table.period_from + 1);
+                table.tokens.resize(table.starts.back());
+                break;
+            }
+        }
+        if (!table.period)
+            table.starts.push_back(table.tokens.size());
+        m_run_tables.push_back(std::move(table));
+        return (uint32_t)(m_run_tables.size() - 1);
+    };
+    m_byte_runs.fill(-1);
+    for (auto& entry : longest) {
+        uint8_t lead = entry.first >> 8, run = entry.first & 0xff;
+        if (lead == run)
+            m_byte_runs[run] = (int32_t)build(-1, run, entry.second);
+    }
+    for (auto& entry : longest) {
+        uint8_t lead = entry.first >> 8, run = entry.first & 0xff;
+        if (lead == run)
+            continue;
+        bool space =
+            lead == ' ' || lead == '\t' || lead == '\n' || lead == '\r';
+        uint32_t table = NO_RUN_TABLE;
+        if (space && m_byte_runs[run] >= 0)
+            table = build(lead, run,
+                          std::max(entry.second, longest.at(run << 8 | run)));
+        m_lead_runs.insert(lead, run, table);
+    }
+}
+
+bool BPE::merge_run(byte_span bytes, std::vector<uint32_t>& output) const {
+    size_t len = bytes.size();
+    if (len < 2)
+        return false;
+    uint8_t lead = (uint8_t)bytes[0], run = (uint8_t)bytes[1];
+    size_t head = lead != run;
+    if ((uint8_t)bytes[len - 1] != run || m_byte_runs[run] < 0)
+        return false;
+    for (size_t i = head + 1; i < len - 1; i++) {
+        if ((uint8_t)bytes[i] != run)
+            return false;
+    }
+    const run_table* table = &m_run_tables[m_byte_runs[run]];
+    bool lone_lead = false;
+    if (head) {
+        const uint32_t* found = m_lead_runs.find(lead, run);
+        if (!found)
+            lone_lead = true;
+        else if (*found == NO_RUN_TABLE)
+            return false;
+        else
+            table = &m_run_tables[*found];
+    }
+    size_t n = len - head;
+    size_t repeats = 0;
+    if (n + 1 >= table->starts.size()) {
+        if (!table->period)
+            return false;
+        repeats = (n - table->period_from) / table->period + 1;
+        n -= repeats * table->period;
+    }
+    if (lone_lead)
+        output.push_back(m_byte_ids[lead]);
+    const uint32_t* tokens = table->tokens.data() + table->starts[n];
+    const uint32_t* end = table->tokens.data() + table->starts[n + 1];
+    output.insert(output.end(), tokens, tokens + table->head);
+    output.insert(output.end(), repeats, table->period_token);
+    output.insert(output.end(), tokens + table->head, end);
+    return true;
+}
+
+// runs the merge loop on a token's own bytes, remembering the last merge.
+// the token is valid when that leaves exactly the token itself
+bool BPE::split_token(uint32_t id, const std::string& bytes) {
+    token_info& info = m_tokens[id];
+    std::vector<uint32_t> words;
+    for (char c : bytes) {
+        words.push_back(m_byte_ids[(uint8_t)c]);
+    }
+    while (words.size() >= 2) {
+        merge_entry to_merge = {UINT32_MAX, BPE_NO_TOKEN};
+        size_t at = 0;
+        for (size_t i = 0; i + 1 < words.size(); i++) {
+            const merge_entry* m = find_merge(words[i], words[i + 1]);
+            if (m && m->rank < to_merge.rank) {
+                to_merge = *m;
+                at = i;
+            }
+        }
+        if (to_merge.rank == UINT32_MAX)
+            return false;
+        uint32_t left = words[at], right = words[at + 1];
+        size_t out = 0;
+        for (size_t i = 0; i < words.size(); i++) {
+            if (words[i] == left && i + 1 < words.size() &&
+                words[i + 1] == right) {
+                words[out++] = to_merge.id;
+                i++;
+            } else {
+                words[out++] = words[i];
+            }
+        }
+        words.resize(out);
+        info.rank = to_merge.rank;
+        info.left = left;
+        info.right = right;
+    }
+    info.valid = words[0] == id;
+    return info.valid;
+}
+
+// whether BPE on the bytes of left followed by the bytes of right ends up
+// as exactly [left, right]. undoes the merges that built the two tokens,
+// latest first, and fails as soon as the pair across the boundary has a
+// rule that would have fired before the merge just undone
+bool BPE::is_valid_pair(uint32_t left, uint32_t right) const {
+    uint32_t limit = UINT32_MAX;
+    while (true) {
+        const merge_entry* m = find_merge(left, right);
+        if (m && m->rank < limit)
+            return false;
+        const token_info& l = m_tokens[left];
+        const token_info& r = m_tokens[right];
+        if (l.rank == BPE_NO_TOKEN && r.rank == BPE_NO_TOKEN)
+            return true;
+        if (r.rank == BPE_NO_TOKEN ||
+            (l.rank != BPE_NO_TOKEN && l.rank > r.rank)) {
+            limit = l.rank;
+            left = l.right;
+        } else {
+            // a boundary pair of the same rank sits left of the one that
+            // built right, and equal ranks merge left to right
+            limit = r.rank + 1;
+            right = r.left;
+        }
+    }
+}
+
+// https://github.com/github/rust-gems/blob/main/crates/bpe/README.md
+bool BPE::bpe_backtrack(byte_span bytes, std::vector<uint32_t>& output) {
+    const char* text = bytes.data();
+    size_t len = bytes.size();
+    // positions known not to start any valid encoding of the rest
+    std::vector<bool> reachable(len + 1, true);
+    std::vector<uint32_t> tokens;
+    size_t pos = 0;
+    uint32_t next = m_trie.longest_prefix(text, len);
+    while (next != BPE_NO_TOKEN) {
+        uint32_t token = next;
+        uint32_t last = tokens.empty() ? BPE_NO_TOKEN : tokens.back();
+        while (true) {
+            size_t end = pos + m_tokens[token].len;
+            if (reachable[end] &&
+                (last == BPE_NO_TOKEN || is_valid_pair(last, token))) {
+                tokens.push_back(token);
+                pos = end;
+                next = m_trie.longest_prefix(text + end, len - end);
+                break;
+            } else if (m_tokens[token].next_prefix != BPE_NO_TOKEN) {
+                token = m_tokens[token].next_prefix;
+            } else if (last == BPE_NO_TOKEN) {
+                // nothing left to back off to, only possible when the
+                // merges are not a trained list
+                return false;
+            } else {
+                reachable[pos] = false;
+                tokens.pop_back();
+                pos -= m_tokens[last].len;
+                next = last;
+                break;
+            }
+        }
+    }
+    if (pos != len)
+        return false;
+    output.insert(output.end(), tokens.begin(), tokens.end());
+    return true;
+}
+
+std::vector<std::string> BPE::pretokenize(const std::string& input) {
+    if (m_pretokenizer == pretokenizer_kind::regex)
+        return pretokenize_regex(input);
+    std::vector<std::string> pretoks;
+    if (scan_pretokens(m_pretokenizer, input, pretoks))
+        return pretoks;
+    // the regex sees invalid UTF-8 as U+FFFD, so the scanner does too
+    std::string replaced;
+    replace_invalid_utf8(input.data(), input.size(), replaced);
+    pretoks.clear();
+    scan_pretokens(m_pretokenizer, replaced, pretoks);
+    return pretoks;
+}
+
+#ifndef BPECPP_NO_ICU
+std::vector<std::string> BPE::pretokenize_regex(const std::string& input) {
+    if (!is_valid_utf8(input.data(), input.size())) {
+        // match U+FFFD in its place, like the scanners do
+        std::string replaced;
+        replace_invalid_utf8(input.data(), input.size(), replaced);
+        return pretokenize_regex(replaced);
+    }
+    // one matcher per thread, reset onto every input. holding on to the
+    // pattern keeps it alive for as long as its matcher is cached
+    static thread_local std::shared_ptr<icu::RegexPattern> matcher_pattern;
+    static thread_local std::unique_ptr<icu::RegexMatcher> matcher;
     UErrorCode uerror = U_ZERO_ERROR;
-    auto bpe_re_icustr = icu::UnicodeString::fromUTF8(BPE_PRETOK_REGEX);
-    if (m_pretok_re == nullptr) {
-        m_pretok_re = std::unique_ptr<icu::RegexPattern>(
-            icu::RegexPattern::compile(bpe_re_icustr, pe, uerror));
+    if (matcher_pattern != m_pretok_re) {
+        matcher.reset(m_pretok_re->matcher(uerror));
         if (!U_SUCCESS(uerror))
-            throw std::runtime_error("Compiling BPE pretokenizer regex failed");
+            throw std::runtime_error("Creating BPE pretokenizer matcher failed");
+        matcher_pattern = m_pretok_re;
     }
-    auto uinput = icu::UnicodeString::fromUTF8(input);
-    std::unique_ptr<icu::RegexMatcher> pretok_matcher(
-        m_pretok_re->matcher(uinput, uerror));
-    std::vector<icu::UnicodeString> pretoks;
-    if (!U_SUCCESS(uerror))
-        throw std::runtime_error("Creating BPE pretokenizer matcher failed");
-    while (pretok_matcher->find()) {
-        auto match = pretok_matcher->group(uerror);
-        if (!U_SUCCESS(uerror))
-            throw std::runtime_error(
-                "Getting BPE pretokenizer regex match failed");
-        std::string s;
-        icu::UnicodeString out;
-        match.toUTF8String(s);
-        for (char c : s) {
-            uint32_t codepoint = m_bs_table.byte_to_codepoint((uint8_t)c);
-            out.append((UChar32)codepoint);
-        }
-        pretoks.push_back(out);
+    matcher->setTimeLimit(m_regex_time_limit, uerror);
+    matcher->setStackLimit(m_regex_stack_limit, uerror);
+    // matched in place, so match offsets are byte offsets into input
+    UText text = UTEXT_INITIALIZER;
+    utext_openUTF8(&text, input.data(), input.size(), &uerror);
+    matcher->reset(&text);
+    // the text between matches is kept as pretokens too, like a Hugging
+    // Face Split with behavior Isolated. the known patterns match
+    // everything, so only other patterns can leave some
+    std::vector<std::string> pretoks;
+    int64_t last = 0;
+    while (matcher->find(uerror)) {
+        int64_t start = matcher->start64(uerror);
+        int64_t end = matcher->end64(uerror);
+        if (start > last)
+            pretoks.push_back(input.substr(last, start - last));
+        pretoks.push_back(input.substr(start, end - start));
+        last = end;
     }
+    if (U_SUCCESS(uerror) && last < (int64_t)input.size())
+        pretoks.push_back(input.substr(last));
+    utext_close(&text);
+    if (uerror == U_REGEX_TIME_OUT)
+        throw bpe_limit_error("BPE pretokenizer regex ran out of time");
+    if (uerror == U_REGEX_STACK_OVERFLOW)
+        throw bpe_limit_error("BPE pretokenizer regex ran out of stack");
+    if (!U_SUCCESS(uerror))
+        throw std::runtime_error("Getting BPE pretokenizer regex match failed");
     return pretoks;
 }
+#else
+std::vector<std::string> BPE::pretokenize_regex(const std::string&) {
+    throw std::runtime_error("BPE pretokenizer regexes need ICU");
+}
+#endif
 
 static std::string regex_escape(const std::string& s) {
     static const std::regex metacharacters(R"([\.\^\$\-\+\(\)\[\]\{\}\|\?\*])");
@@ -1,21 +1,37 @@
 #pragma once
+#ifndef BPECPP_NO_ICU
 #include <unicode/regex.h>
-#include <unicode/unistr.h>
+#endif
 
+#include <array>
 #include <cstdint>
+#include <memory>
 #include <regex>
+#include <stdexcept>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include "csr_index.h"
+#include "flat_map.h"
+#include "pretokenize.h"
+
 namespace bpecpp {
-typedef std::pair<icu::UnicodeString, icu::UnicodeString> UnicodeBigram;
+// marks a symbol that has no id in the vocab
+const uint32_t BPE_NO_TOKEN = UINT32_MAX;
+
+// a merge rule, looked up by the (left, right) ids of the pair it joins
+struct merge_entry {
+    uint32_t rank;
+    uint32_t id;
+};
 
 class bpe_char_byte_table {
    public:
     bpe_char_byte_table() {
+        m_codepoint_to_byte.fill(-1);
         int n = 0;
-        for (uint8_t byte = 0; m_codepoint_to_byte.size() < 256; byte++) {
+        for (int byte = 0; byte < 256; byte++) {
             bool keep = (byte >= '!' && byte <= '~') ||
                         (byte >= 0xa1 && byte <= 0xac) ||
                         (byte >= 0xae && byte <= 0xff);
@@ -25,55 +41,386 @@ class bpe_char_byte_table {
                 n++;
             }
             m_byte_to_codepoint[byte] = codepoint;
-            m_codepoint_to_byte[codepoint] = byte;
+            m_codepoint_to_byte[codepoint] = (int16_t)byte;
         };
     }
-    uint32_t byte_to_codepoint(uint8_t byte) {
+    uint32_t byte_to_codepoint(uint8_t byte) const {
         return m_byte_to_codepoint[byte];
     }
 
-    uint8_t codepoint_to_byte(uint32_t codepoint) {
-        return m_codepoint_to_byte.at(codepoint);
+    // -1 if the codepoint does not stand for a byte
+    int find_byte(uint32_t codepoint) const {
+        return codepoint < m_codepoint_to_byte.size()
+                   ? m_codepoint_to_byte[codepoint]
+                   : -1;
+    }
+
+    uint8_t codepoint_to_byte(uint32_t codepoint) const {
+        int byte = find_byte(codepoint);
+        if (byte < 0)
+            throw std::out_of_range("codepoint does not stand for a byte");
+        return (uint8_t)byte;
     }
 
    private:
     std::array<uint32_t, 256> m_byte_to_codepoint;
-    std::unordered_map<uint32_t, uint8_t> m_codepoint_to_byte;
+    // the 256 codepoints used all fall below 512
+    std::array<int16_t, 512> m_codepoint_to_byte;
 };
 
-struct bigram_hash {
-    std::size_t operator()(const UnicodeBigram& pair) const {
-        return pair.first.hashCode() + pair.second.hashCode();
-    }
+// algorithm used to apply the merges within a pretoken
+enum class bpe_engine {
+    // rescan every adjacent pair after each merge, O(n^2)
+    naive,
+    // linked list of symbols plus a rank-ordered queue of candidate pairs,
+    // only the neighbors of a merge are looked up again, O(n log n). gives
+    // the same result as naive unless a rule ranks below one of the rules
+    // building its parts, which never happens in a trained merge list
+    heap,
+    // longest-match walk over a trie of the vocab, backing off to shorter
+    // tokens when a pair of adjacent tokens could not come out of the
+    // merges. linear in the pretoken length
+    backtrack,
+    // an array of ids plus a parallel array of the rank of each id's pair
+    // with the next one. each step finds the lowest rank with a vector
+    // argmin, merges it and only recomputes the two ranks next to it
+    rank_array,
+    // picks one of the above per pretoken by its length in bytes, see
+    // adaptive_thresholds
+    adaptive,
 };
 
-struct icu_hash {
-    std::size_t operator()(const icu::UnicodeString& us) const {
-        return us.hashCode();
-    }
+// where the adaptive engine switches algorithms. the defaults are the
+// crossover points benchtok measured on a byte-level vocab, run it to
+// calibrate for another vocab or machine
+struct adaptive_thresholds {
+    // pretokens up to this many bytes use the naive engine
+    size_t naive_max = 5;
+    // longer ones up to this many use the rank array engine, anything
+    // longer backtracks
+    size_t rank_array_max = 256;
+    // when several pretokens are encoded together, ones up to this many
+    // bytes are merged 8 at a time in vector lanes instead. needs an AVX2
+    // build and the hashed merge lookup. off by default: on real text the
+    // lengths are mixed, lanes idle until their longest pretoken is done
+    // and it measured slower. benchtok suggests a value for a vocab
+    size_t lanes_max = 0;
+};
+
+// structure the engines look merge rules up in
+enum class merge_lookup {
+    // flat_map keyed by the packed id pair
+    hashed,
+    // per left id, a sorted row of the rules starting with it
+    csr,
+};
+
+// what the backtracking engine knows about a token
+struct token_info {
+    uint32_t len = 0;
+    // rank of the rule whose merge completes this token when BPE runs on
+    // its own bytes, BPE_NO_TOKEN for the single-byte tokens
+    uint32_t rank = BPE_NO_TOKEN;
+    // the two tokens that rule joins
+    uint32_t left = BPE_NO_TOKEN;
+    uint32_t right = BPE_NO_TOKEN;
+    // longest token that is a proper prefix of this one
+    uint32_t next_prefix = BPE_NO_TOKEN;
+    // BPE of the token's own bytes gives back exactly this token
+    bool valid = false;
+};
+
+// BPE of the pretokens made of a run of one byte, after an optional lead
+// byte that differs from it, by the length of the run
+struct run_table {
+    // tokens of the run of n bytes are tokens[starts[n], starts[n + 1])
+    std::vector<uint32_t> starts;
+    std::vector<uint32_t> tokens;
+    // 1 with a lead byte, for the token holding it, 0 without
+    uint32_t head = 0;
+    // from period_from bytes on, a run is the one period bytes shorter
+    // with one more period_token after the head. 0 if the runs the table
+    // was built for never settled into that
+    size_t period_from = 0;
+    size_t period = 0;
+    uint32_t period_token = BPE_NO_TOKEN;
+};
+
+// byte trie over the valid tokens of the vocab. edges of node n are
+// m_edge_byte/m_edge_node[m_first_edge[n] .. m_first_edge[n + 1]), sorted
+class token_trie {
+   public:
+    void build(const std::vector<std::pair<std::string, uint32_t>>& tokens);
+    // id of the longest token that [s, s + len) starts with
+    uint32_t longest_prefix(const char* s, size_t len) const;
+
+   private:
+    uint32_t child(uint32_t node, uint8_t byte) const;
+
+    std::array<uint32_t, 256> m_root_child;
+    std::vector<uint32_t> m_node_token;
+    std::vector<uint32_t> m_first_edge;
+    std::vector<uint8_t> m_edge_byte;
+    std::vector<uint32_t> m_edge_node;
+};
+
+// settings a BPE is constructed with
+struct bpe_options {
+    // renumber tokens internally by how often they occur, so that the
+    // table entries of frequent tokens share cache lines. ids going in and
+    // out of the BPE stay the vocab's. counts are indexed by vocab id; if
+    // there are none they are taken by encoding frequency_sample
+    std::vector<uint64_t> token_counts;
+    std::string frequency_sample;
+    // applications of each merge rank, as returned by BPE::merge_trace().
+    // up to hot_merges of the most applied rules get a small table of
+    // their own that the hashed lookup tries first, so it stays in cache
+    std::vector<uint64_t> merge_counts;
+    size_t hot_merges = 4096;
+    // the tokenizer's pretokenizer pattern, BPE_PRETOK_REGEX if empty.
+    // known patterns get a hand-written scanner, others run through ICU.
+    // text between matches is a pretoken of its own, not dropped
+    std::string pretokenizer_regex;
+    // NFC normalize input before pretokenizing it
+    bool normalize = true;
+    // prepend a space to input that does not start with one
+    bool add_prefix_space = false;
+    // a pretoken that is in the vocab becomes that token, even where its
+    // merges would not build it
+    bool ignore_merges = false;
+    // start merging a multibyte character from its tokens rather than its
+    // bytes where that cannot change the result. saves merge rounds on
+    // text made of such characters but costs a lookup per character, which
+    // makes text with few of them slower
+    bool seed_characters = false;
+    // pretokens longer than this many bytes are cut into pieces that are
+    // merged on their own, bounding the work a single huge pretoken takes.
+    // every cut is this many bytes after the last one, moved back to the
+    // start of the UTF-8 character it falls into. tokens never span a
+    // cut, so output can differ from the tokenizer's. 0 for no limit,
+    // otherwise at least 4
+    size_t max_pretoken_bytes = 0;
+    // limits of the ICU matcher running the pretokenizer regex, which
+    // encode only does for a pattern without a scanner. see
+    // RegexMatcher::setTimeLimit and setStackLimit. the time
+    // limit counts steps of the match engine, typically in the order of a
+    // millisecond each, the stack limit bytes. 0 for no limit. running
+    // into either throws bpe_limit_error
+    int32_t regex_time_limit = 0;
+    int32_t regex_stack_limit = 8 << 20;
+};
+
+// input ran into one of the limits of bpe_options
+class bpe_limit_error : public std::runtime_error {
+   public:
+    using std::runtime_error::runtime_error;
 };
 
 class BPE {
    public:
     BPE(std::unordered_map<std::string, uint32_t> vocab,
-        std::vector<std::string> merges);
+        std::vector<std::string> merges,
+        const bpe_options& options = bpe_options());
+    // the pipeline a Hugging Face tokenizer.json declares: the vocab and
+    // merges of its model and its normalizer, pre_tokenizer and decoder.
+    // throws for a stage it cannot run. options supplies the rest, its
+    // normalization and pretokenizer settings are overwritten
+    static BPE from_tokenizer_json(const std::string& json_text,
+                                   bpe_options options = bpe_options());
+
+    void set_engine(bpe_engine engine) { m_engine = engine; }
+    bpe_engine engine() const { return m_engine; }
+    void set_adaptive_thresholds(adaptive_thresholds thresholds) {
+        m_thresholds = thresholds;
+    }
+    adaptive_thresholds thresholds() const { return m_thresholds; }
+
+    void set_merge_lookup(merge_lookup lookup) { m_merge_lookup = lookup; }
+    merge_lookup lookup() const { return m_merge_lookup; }
+
+    // probes of the rules outside the hot table
+    probe_stats merge_stats() const { return m_merges.stats(); }
+
+    // while on, counts how often encode and encode_pretoken(s) apply each
+    // merge rank, whatever the engine. turning it on clears the counts
+    void set_merge_trace(bool on);
+    // applications per rank since tracing was turned on, indexed by rank
+    const std::vector<uint64_t>& merge_trace() const { return m_merge_trace; }
 
     std::vector<uint32_t> encode(const std::string& input);
+    // runs only the merge stage, on the raw bytes of a single pretoken
+    void encode_pretoken(const std::string& bytes,
+                         std::vector<uint32_t>& output);
+    // the merge stage for many pretokens. ends[i] is where the tokens of
+    // pretokens[i] end in output
+    void encode_pretokens(const std::vector<std::string>& pretokens,
+                          std::vector<uint32_t>& output,
+                          std::vector<size_t>& ends);
 
     std::string decode(const std::vector<uint32_t>& tokens,
                        bool valid_utf8 = true);
 
+    pretokenizer_kind pretokenizer() const { return m_pretokenizer; }
+    // splits normalized text into pretokens with the pretokenizer pattern,
+    // giving the raw bytes of each. pretokenize uses the pattern's scanner
+    // if it has one, pretokenize_regex always the regex itself
+    std::vector<std::string> pretokenize(const std::string& input);
+    std::vector<std::string> pretokenize_regex(const std::string& input);
+
    private:
-    std::unordered_map<icu::UnicodeString, uint32_t, icu_hash> m_vocab;
-    std::unordered_map<uint32_t, icu::UnicodeString> m_reverse_vocab;
-    std::unordered_map<UnicodeBigram, size_t, bigram_hash> m_merges;
-    bpe_char_byte_table m_bs_table;
-
-    void bpe(icu::UnicodeString token_pretoked,
-             std::vector<icu::UnicodeString>& output);
-    std::unique_ptr<icu::RegexPattern> m_pretok_re;
-    std::string normalize_nfc(const std::string& input);
-    std::vector<icu::UnicodeString> pretokenize(const std::string& input);
+    // internal id -> vocab id and back, empty unless tokens were
+    // renumbered by frequency. everything below uses internal ids
+    std::vector<uint32_t> m_external;
+    std::vector<uint32_t> m_internal;
+    // rewrites tokens[begin, end) to vocab ids
+    void to_external(std::vector<uint32_t>& tokens, size_t begin) const;
+    size_t m_rank_count = 0;
+    bool m_tracing = false;
+    std::vector<uint64_t> m_merge_trace;
+    // adds the merges that built tokens[begin, end) to m_merge_trace
+    void trace(const std::vector<uint32_t>& tokens, size_t begin);
+    // encode_pretoken(s) in internal ids
+    void merge_pretoken(byte_span bytes, std::vector<uint32_t>& output);
+    // ends gets the output size after each pretoken unless null
+    void merge_pretokens(const byte_span* pretokens,
+                         size_t count,
+                         std::vector<uint32_t>& output,
+                         std::vector<size_t>* ends);
+    // how many pretokens encode has in flight at once
+    static const size_t PRETOKEN_WINDOW = 256;
+    // bytes of input encode normalizes and pretokenizes in one go, the
+    // chunk extends to the next pretoken_cut after this
+    static const size_t TEXT_CHUNK = 16384;
+    // pretokenizes normalized text with the scanner and merges it. false
+    // if the text is not valid UTF-8, with only some of it merged
+    bool merge_text(byte_span text, std::vector<uint32_t>& output);
+
+    // (left id, right id) -> rank and id of the merged token, for every
+    // rule not in m_merges_hot
+    flat_map<merge_entry> m_merges;
+    // the most applied rules of bpe_options::merge_counts. empty without a
+    // profile
+    flat_map<merge_entry> m_merges_hot;
+    // the same rules, rows indexed by left id
+    csr_index<merge_entry> m_merges_csr;
+    merge_lookup m_merge_lookup = merge_lookup::hashed;
+    // id of the single-byte token for each byte
+    std::array<uint32_t, 256> m_byte_ids;
+    // the rule joining every pair of single-byte tokens, indexed by
+    // (left byte << 8 | right byte). rank is UINT32_MAX where there is none
+    std::vector<merge_entry> m_byte_pairs;
+    bpe_engine m_engine = bpe_engine::adaptive;
+    adaptive_thresholds m_thresholds;
+
+    const merge_entry* find_merge(uint32_t left, uint32_t right) const {
+        if (m_merge_lookup == merge_lookup::csr)
+            return m_merges_csr.find(left, right);
+        if (m_merges_hot.size()) {
+            const merge_entry* hot = m_merges_hot.find(left, right);
+            if (hot)
+                return hot;
+        }
+        return m_merges.find(left, right);
+    }
+    // calls f(left, right, entry) for the rules of both tables
+    template <typename F>
+    void for_each_merge(F f) const {
+        m_merges_hot.for_each(f);
+        m_merges.for_each(f);
+    }
+    const merge_entry& find_byte_pair(char left, char right) const {
+        return m_byte_pairs[((uint8_t)left << 8) | (uint8_t)right];
+    }
+    void bpe_naive(byte_span bytes, std::vector<uint32_t>& output);
+    void bpe_heap(byte_span bytes, std::vector<uint32_t>& output);
+    void bpe_rank_array(byte_span bytes, std::vector<uint32_t>& output);
+    bool bpe_backtrack(byte_span bytes, std::vector<uint32_t>& output);
+    // most bytes a pretoken merged in a vector lane can have
+    static const size_t LANE_BYTES = 16;
+    // merges up to 8 pretokens of at most LANE_BYTES bytes in lockstep.
+    // row i of out (LANE_BYTES wide) gets the tokens of words[i]
+    void bpe_lanes(const byte_span* words,
+                   size_t count,
+                   uint32_t* out,
+                   uint8_t* lens);
+
+    // indexed by id, filled in for every id up to the largest in the vocab
+    std::vector<token_info> m_tokens;
+    // raw bytes of every token, what decode emits for it
+    std::vector<std::string> m_token_bytes;
+    token_trie m_trie;
+    // valid tokens, or all of them with bpe_options::ignore_merges, so a
+    // pretoken equal to one is its own encoding. up to
+    // 7 bytes keyed by the bytes and their length packed into an integer,
+    // longer ones by a hash of their bytes
+    flat_map<uint32_t> m_self_tokens_short;
+    flat_map<uint32_t> m_self_tokens_long;
+    void init_tokens(
+        const std::unordered_map<std::string, uint32_t>& byte_vocab,
+        bool ignore_merges);
+    uint32_t find_self_token(byte_span bytes) const;
+    // BPE of the multibyte characters in the vocab on their own, for the
+    // ones it is safe to start merging a pretoken from: every rule joining
+    // a symbol at the edge of the character, at any point of its merging,
+    // with anything outside ranks after the last merge inside it. in any
+    // pretoken the character is then merged completely before something
+    // joins it. blocks of codepoints like unicode_tables.h, the value for
+    // c is m_seed_data[m_seed_blocks[c >> SEED_BLOCK_SHIFT] <<
+    // SEED_BLOCK_SHIFT | (c & ((1 << SEED_BLOCK_SHIFT) - 1))], start << 2
+    // | count - 1 of its tokens in m_seed_tokens or NO_SEED. block 0 has
+    // no seeds and neither have the codepoints past the blocks
+    static const int SEED_BLOCK_SHIFT = 6;
+    static const uint32_t NO_SEED = UINT32_MAX;
+    std::vector<uint32_t> m_seed_blocks;
+    std::vector<uint32_t> m_seed_data;
+    std::vector<uint32_t> m_seed_tokens;
+    void init_seeds(
+        const std::unordered_map<std::string, uint32_t>& byte_vocab);
+    uint32_t find_seed(int32_t c) const {
+        size_t block = (size_t)c >> SEED_BLOCK_SHIFT;
+        if (block >= m_seed_blocks.size())
+            return NO_SEED;
+        return m_seed_data[m_seed_blocks[block] << SEED_BLOCK_SHIFT |
+                           (c & ((1 << SEED_BLOCK_SHIFT) - 1))];
+    }
+    // the symbols BPE of bytes starts from, one per byte but for the
+    // characters with a seed. if there were any of those it returns true
+    // and pairs gets the rule joining each symbol with the next one, null
+    // or of rank UINT32_MAX if there is none
+    bool seed(byte_span bytes,
+              std::vector<uint32_t>& ids,
+              std::vector<const merge_entry*>& pairs) const;
+    // tables for the runs of the bytes that have a token of two of them,
+    // indentation, digits and rulers mostly, built by merging runs of
+    // growing length until their tokens repeat
+    std::vector<run_table> m_run_tables;
+    // index of the table for runs of a byte without a lead, -1 for none
+    std::array<int32_t, 256> m_byte_runs;
+    // (lead byte, run byte) -> index of the table, for the pairs with a
+    // token of the lead followed by run bytes. tables are only built for
+    // whitespace leads, the rest are NO_RUN_TABLE and take an engine. a
+    // lead without a token merges with nothing and precedes the run's
+    // tokens on its own
+    flat_map<uint32_t> m_lead_runs;
+    static const uint32_t NO_RUN_TABLE = UINT32_MAX;
+    void init_run_tables(
+        const std::unordered_map<std::string, uint32_t>& byte_vocab);
+    // false unless bytes are such a run and a table has its tokens
+    bool merge_run(byte_span bytes, std::vector<uint32_t>& output) const;
+    bool split_token(uint32_t id, const std::string& bytes);
+    bool is_valid_pair(uint32_t left, uint32_t right) const;
+    std::string m_pretok_regex;
+    pretokenizer_kind m_pretokenizer;
+    bool m_normalize;
+    bool m_add_prefix_space;
+    // bpe_options::max_pretoken_bytes
+    size_t m_max_pretoken_bytes;
+#ifndef BPECPP_NO_ICU
+    // shared with the per-thread matchers running it
+    std::shared_ptr<icu::RegexPattern> m_pretok_re;
+    int32_t m_regex_time_limit;
+    int32_t m_regex_stack_limit;
+#endif
 };
 
 struct additional_vocab_item {
@@ -0,0 +1,111 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace bpecpp {
+// compressed sparse row index of pair rules: for every left id, the rules
+// starting with it are a contiguous run of m_right/m_value sorted by right
+// id. short runs are scanned with vector compares, long ones binary
+// searched without branches, so a lookup never hashes and reads at most a
+// few cache lines of one row
+template <typename V>
+class csr_index {
+   public:
+    // rows up to this long are scanned rather than searched
+    static const uint32_t SCAN_ROW = 16;
+
+    void build(std::vector<std::tuple<uint32_t, uint32_t, V>> rules) {
+        std::sort(rules.begin(), rules.end(),
+                  [](const std::tuple<uint32_t, uint32_t, V>& a,
+                     const std::tuple<uint32_t, uint32_t, V>& b) {
+                      return std::get<0>(a) != std::get<0>(b)
+                                 ? std::get<0>(a) < std::get<0>(b)
+                                 : std::get<1>(a) < std::get<1>(b);
+                  });
+        uint32_t rows = rules.empty() ? 0 : std::get<0>(rules.back()) + 1;
+        m_row_start.assign(rows + 1, 0);
+        m_right.clear();
+        m_value.clear();
+        for (auto& rule : rules) {
+            m_row_start[std::get<0>(rule) + 1]++;
+            m_right.push_back(std::get<1>(rule));
+            m_value.push_back(std::get<2>(rule));
+        }
+        for (uint32_t row = 0; row < rows; row++) {
+            m_row_start[row + 1] += m_row_start[row];
+        }
+        // the vector scan may read a full register past the last row
+        m_right.resize(m_right.size() + 8, UINT32_MAX);
+    }
+
+    const V* find(uint32_t left, uint32_t right) const {
+        // size_t so that BPE_NO_TOKEN does not wrap around to row 0
+        if ((size_t)left + 1 >= m_row_start.size())
+            return nullptr;
+        uint32_t begin = m_row_start[left];
+        uint32_t end = m_row_start[left + 1];
+        size_t at = end - begin <= SCAN_ROW ? scan(begin, end, right)
+                                            : search(begin, end, right);
+        return at < end ? &m_value[at] : nullptr;
+    }
+
+   private:
+    std::vector<uint32_t> m_row_start;
+    std::vector<uint32_t> m_right;
+    std::vector<V> m_value;
+
+    // index of right in [begin, end), or end
+    size_t scan(uint32_t begin, uint32_t end, uint32_t right) const {
+        const uint32_t* rights = m_right.data();
+#if defined(__AVX2__)
+        __m256i needle = _mm256_set1_epi32((int)right);
+        for (uint32_t i = begin; i < end; i += 8) {
+            __m256i block =
+                _mm256_loadu_si256((const __m256i*)(rights + i));
+            uint32_t mask = (uint32_t)_mm256_movemask_ps(
+                _mm256_castsi256_ps(_mm256_cmpeq_epi32(block, needle)));
+            if (mask)
+                return std::min<size_t>(i + __builtin_ctz(mask), end);
+        }
+        return end;
+#elif defined(__SSE2__)
+        __m128i needle = _mm_set1_epi32((int)right);
+        for (uint32_t i = begin; i < end; i += 4) {
+            __m128i block = _mm_loadu_si128((const __m128i*)(rights + i));
+            uint32_t mask = (uint32_t)_mm_movemask_ps(
+                _mm_castsi128_ps(_mm_cmpeq_epi32(block, needle)));
+            if (mask)
+                return std::min<size_t>(i + __builtin_ctz(mask), end);
+        }
+        return end;
+#else
+        for (uint32_t i = begin; i < end; i++) {
+            if (rights[i] == right)
+                return i;
+        }
+        return end;
+#endif
+    }
+
+    size_t search(uint32_t begin, uint32_t end, uint32_t right) const {
+        const uint32_t* base = m_right.data() + begin;
+        size_t len = end - begin;
+        // narrow down to the last entry <= right, the compare compiles to
+        // a conditional move
+        while (len > 1) {
+            size_t half = len / 2;
+            base = base[half] <= right ? base + half : base;
+            len -= half;
+        }
+        return *base == right ? base - m_right.data() : end;
+    }
+};
+}  // namespace bpecpp
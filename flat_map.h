@@ -0,0 +1,218 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace bpecpp {
+// how long lookups in a flat_map have to walk
+struct probe_stats {
+    size_t size = 0;
+    size_t capacity = 0;
+    // slots inspected to find an entry, averaged over / maximum of all
+    // entries. 1 means every entry sits in its home slot
+    double mean_probe = 0;
+    size_t max_probe = 0;
+};
+
+// open-addressing hash map from a pair of 32-bit ids packed into one 64-bit
+// key to a small value, stored inline in a single power-of-two array. uses
+// robin hood probing so it stays fast at a high load factor, and misses
+// stop as soon as they pass the slot where the key would have been
+template <typename V>
+class flat_map {
+   public:
+    static const uint64_t EMPTY = UINT64_MAX;
+
+    // not symmetric, so (a, b) and (b, a) land in unrelated slots. only
+    // uses 32-bit arithmetic so it can be computed in vector lanes too
+    static uint32_t hash(uint32_t left, uint32_t right) {
+        uint32_t h = left * 0x9e3779b1u + right * 0x85ebca77u;
+        h ^= h >> 15;
+        h *= 0x2c1b3c6du;
+        h ^= h >> 12;
+        return h;
+    }
+
+    static uint64_t key(uint32_t left, uint32_t right) {
+        return ((uint64_t)left << 32) | right;
+    }
+
+    // replaces the value if the pair is already present
+    void insert(uint32_t left, uint32_t right, const V& value) {
+        // keep the load factor at or below 7/8
+        if ((m_size + 1) * 8 > m_slots.size() * 7)
+            rehash(m_slots.empty() ? 16 : m_slots.size() * 2);
+        insert_slot({key(left, right), value});
+    }
+
+    const V* find(uint32_t left, uint32_t right) const {
+        uint64_t k = key(left, right);
+        // the key of an empty slot, a pair of ids missing from the vocab
+        // would otherwise find one
+        if (m_slots.empty() || k == EMPTY)
+            return nullptr;
+        size_t pos = hash(left, right) & m_mask;
+        for (size_t dist = 0;; dist++) {
+            const slot& s = m_slots[pos];
+            if (s.key == k)
+                return &s.value;
+            if (s.key == EMPTY || distance(s.key, pos) < dist)
+                return nullptr;
+            pos = (pos + 1) & m_mask;
+        }
+    }
+
+#if defined(__AVX2__)
+    // find() for 8 pairs at once, one per lane, reading the slots with
+    // gathers. V has to be two 32-bit words; lanes that find their pair get
+    // them in first/second, the others keep what was there
+    void find8(__m256i left, __m256i right, __m256i& first,
+               __m256i& second) const {
+        static_assert(sizeof(slot) == 16, "find8 needs 8-byte values");
+        if (m_slots.empty())
+            return;
+        // a slot is four ints: right, left, first, second
+        const int* base = (const int*)m_slots.data();
+        const __m256i ones = _mm256_set1_epi32(-1);
+        const __m256i mask = _mm256_set1_epi32((int)m_mask);
+        __m256i pos = _mm256_and_si256(hash8(left, right), mask);
+        __m256i pending = ones;
+        for (int dist = 0;; dist++) {
+            __m256i at = _mm256_slli_epi32(pos, 2);
+            __m256i lo = _mm256_mask_i32gather_epi32(ones, base, at, pending, 4);
+            __m256i hi =
+                _mm256_mask_i32gather_epi32(ones, base + 1, at, pending, 4);
+            __m256i empty = _mm256_and_si256(_mm256_cmpeq_epi32(lo, ones),
+                                             _mm256_cmpeq_epi32(hi, ones));
+            __m256i hit = _mm256_andnot_si256(
+                empty, _mm256_and_si256(
+                           pending, _mm256_and_si256(
+                                        _mm256_cmpeq_epi32(lo, right),
+                                        _mm256_cmpeq_epi32(hi, left))));
+            if (!_mm256_testz_si256(hit, hit)) {
+                first = _mm256_mask_i32gather_epi32(first, base + 2, at, hit, 4);
+                second =
+                    _mm256_mask_i32gather_epi32(second, base + 3, at, hit, 4);
+            }
+            // same stopping rule as find(): an empty slot or an entry
+            // closer to its home than we are to ours
+            __m256i home = _mm256_and_si256(hash8(hi, lo), mask);
+            __m256i away = _mm256_and_si256(_mm256_sub_epi32(pos, home), mask);
+            __m256i passed =
+                _mm256_cmpgt_epi32(_mm256_set1_epi32(dist), away);
+            pending = _mm256_andnot_si256(
+                _mm256_or_si256(hit, _mm256_or_si256(empty, passed)), pending);
+            if (_mm256_testz_si256(pending, pending))
+                return;
+            pos = _mm256_and_si256(_mm256_add_epi32(pos, _mm256_set1_epi32(1)),
+                                   mask);
+        }
+    }
+
+    // hash() of each lane
+    static __m256i hash8(__m256i left, __m256i right) {
+        __m256i h = _mm256_add_epi32(
+            _mm256_mullo_epi32(left, _mm256_set1_epi32((int)0x9e3779b1u)),
+            _mm256_mullo_epi32(right, _mm256_set1_epi32((int)0x85ebca77u)));
+        h = _mm256_xor_si256(h, _mm256_srli_epi32(h, 15));
+        h = _mm256_mullo_epi32(h, _mm256_set1_epi32(0x2c1b3c6d));
+        return _mm256_xor_si256(h, _mm256_srli_epi32(h, 12));
+    }
+#endif
+
+    // grows the table up front so that n entries fit without rehashing
+    void reserve(size_t n) {
+        size_t capacity = 16;
+        while (capacity * 7 < n * 8) {
+            capacity *= 2;
+        }
+        if (capacity > m_slots.size())
+            rehash(capacity);
+    }
+
+    size_t size() const { return m_size; }
+
+    template <typename F>
+    void for_each(F f) const {
+        for (const slot& s : m_slots) {
+            if (s.key != EMPTY)
+                f((uint32_t)(s.key >> 32), (uint32_t)s.key, s.value);
+        }
+    }
+
+    probe_stats stats() const {
+        probe_stats st;
+        st.size = m_size;
+        st.capacity = m_slots.size();
+        size_t total = 0;
+        for (size_t pos = 0; pos < m_slots.size(); pos++) {
+            if (m_slots[pos].key == EMPTY)
+                continue;
+            size_t probe = distance(m_slots[pos].key, pos) + 1;
+            total += probe;
+            if (probe > st.max_probe)
+                st.max_probe = probe;
+        }
+        if (m_size)
+            st.mean_probe = (double)total / m_size;
+        return st;
+    }
+
+   private:
+    struct slot {
+        uint64_t key;
+        V value;
+    };
+
+    std::vector<slot> m_slots;
+    size_t m_mask = 0;
+    size_t m_size = 0;
+
+    // how far the entry at pos is from its home slot
+    size_t distance(uint64_t k, size_t pos) const {
+        size_t home = hash((uint32_t)(k >> 32), (uint32_t)k) & m_mask;
+        return (pos - home) & m_mask;
+    }
+
+    void insert_slot(slot entry) {
+        size_t pos = hash((uint32_t)(entry.key >> 32), (uint32_t)entry.key) &
+                     m_mask;
+        for (size_t dist = 0;; dist++) {
+            slot& s = m_slots[pos];
+            if (s.key == EMPTY) {
+                s = entry;
+                m_size++;
+                return;
+            }
+            if (s.key == entry.key) {
+                s.value = entry.value;
+                return;
+            }
+            // take the slot from an entry closer to its home than we are
+            size_t existing = distance(s.key, pos);
+            if (existing < dist) {
+                std::swap(s, entry);
+                dist = existing;
+            }
+            pos = (pos + 1) & m_mask;
+        }
+    }
+
+    void rehash(size_t capacity) {
+        std::vector<slot> old;
+        old.swap(m_slots);
+        m_slots.assign(capacity, slot{EMPTY, V()});
+        m_mask = capacity - 1;
+        m_size = 0;
+        for (const slot& s : old) {
+            if (s.key != EMPTY)
+                insert_slot(s);
+        }
+    }
+};
+}  // namespace bpecpp
@@ -0,0 +1,185 @@
+// writes unicode_tables.h, the Unicode data a BPECPP_USE_ICU=OFF build
+// uses instead of ICU, from the ICU this is linked against:
+//   gen_unicode_tables > unicode_tables.h
+#include <unicode/normalizer2.h>
+#include <unicode/uchar.h>
+#include <unicode/uversion.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+static const UChar32 MAX_CP = 0x10ffff;
+static const int BLOCK_SHIFT = 7;
+static const UChar32 BLOCK_SIZE = 1 << BLOCK_SHIFT;
+
+// algorithmic Hangul syllables are left to the code
+static bool is_hangul_syllable(UChar32 c) {
+    return c >= 0xac00 && c < 0xac00 + 11172;
+}
+
+// prints values as a C++ array, a handful per line
+template <typename T>
+static void print_array(const char* type,
+                        const char* name,
+                        const std::vector<T>& values) {
+    std::cout << "constexpr " << type << " " << name << "[] = {";
+    for (size_t i = 0; i < values.size(); i++) {
+        std::cout << (i % 12 ? " " : "\n    ") << (uint64_t)values[i] << ",";
+    }
+    std::cout << "\n};\n\n";
+}
+
+int main() {
+    UErrorCode uerror = U_ZERO_ERROR;
+    const icu::Normalizer2* nfc = icu::Normalizer2::getNFCInstance(uerror);
+    const icu::Normalizer2* nfd = icu::Normalizer2::getNFDInstance(uerror);
+    if (!U_SUCCESS(uerror)) {
+        std::cerr << "could not get ICU normalizers" << std::endl;
+        return 1;
+    }
+
+    // per codepoint records, deduplicated, then blocks of record indices
+    std::map<uint32_t, uint32_t> record_ids;
+    std::vector<uint32_t> records;
+    std::map<std::vector<uint32_t>, uint32_t> block_ids;
+    std::vector<uint32_t> blocks;
+    std::vector<uint32_t> block_data;
+    for (UChar32 base = 0; base <= MAX_CP; base += BLOCK_SIZE) {
+        std::vector<uint32_t> block;
+        for (UChar32 c = base; c < base + BLOCK_SIZE; c++) {
+            uint32_t qc = 0;
+            switch (u_getIntPropertyValue(c, UCHAR_NFC_QUICK_CHECK)) {
+                case UNORM_NO:
+                    qc = 1;
+                    break;
+                case UNORM_MAYBE:
+                    qc = 2;
+                    break;
+                default:
+                    break;
+            }
+            uint32_t record = (uint32_t)u_charType(c) |
+                              (uint32_t)u_isUWhiteSpace(c) << 5 |
+                              (uint32_t)u_isUAlphabetic(c) << 6 | qc << 7 |
+                              (uint32_t)u_getCombiningClass(c) << 9;
+            auto found = record_ids.find(record);
+            if (found == record_ids.end()) {
+                found = record_ids.emplace(record, records.size()).first;
+                records.push_back(record);
+            }
+            block.push_back(found->second);
+        }
+        auto found = block_ids.find(block);
+        if (found == block_ids.end()) {
+            found = block_ids
+                        .emplace(block,
+                                 (uint32_t)(block_data.size() / BLOCK_SIZE))
+                        .first;
+            block_data.insert(block_data.end(), block.begin(), block.end());
+        }
+        blocks.push_back(found->second);
+    }
+    if (records.size() > 256) {
+        std::cerr << "more than 256 distinct records" << std::endl;
+        return 1;
+    }
+
+    // full canonical decompositions and the pairs that compose
+    std::vector<uint32_t> decomp_cps;
+    std::vector<uint32_t> decomp_start;
+    std::vector<uint32_t> decomp_data;
+    std::vector<uint64_t> compose_pairs;
+    std::vector<uint32_t> compose_results;
+    for (UChar32 c = 0; c <= MAX_CP; c++) {
+        if (is_hangul_syllable(c))
+            continue;
+        icu::UnicodeString decomposition;
+        if (nfd->getDecomposition(c, decomposition)) {
+            decomp_cps.push_back(c);
+            decomp_start.push_back(decomp_data.size());
+            for (int32_t i = 0; i < decomposition.length();) {
+                UChar32 d = decomposition.char32At(i);
+                decomp_data.push_back(d);
+                i += U16_LENGTH(d);
+            }
+        }
+        icu::UnicodeString raw;
+        if (nfd->getRawDecomposition(c, raw) &&
+            raw.countChar32() == 2) {
+            UChar32 first = raw.char32At(0);
+            UChar32 second = raw.char32At(U16_LENGTH(first));
+            if (nfc->composePair(first, second) == c) {
+                compose_pairs.push_back((uint64_t)first << 21 | second);
+                compose_results.push_back(c);
+            }
+        }
+    }
+    decomp_start.push_back(decomp_data.size());
+    if (decomp_data.size() > UINT16_MAX) {
+        std::cerr << "too many decomposition codepoints" << std::endl;
+        return 1;
+    }
+    // sorted for binary search, getRawDecomposition goes by composite
+    std::vector<size_t> order(compose_pairs.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return compose_pairs[a] < compose_pairs[b];
+    });
+    std::vector<uint64_t> sorted_pairs;
+    std::vector<uint32_t> sorted_results;
+    for (size_t i : order) {
+        sorted_pairs.push_back(compose_pairs[i]);
+        sorted_results.push_back(compose_results[i]);
+    }
+
+    // codepoints outside ASCII whose simple case folding is ASCII
+    std::vector<uint32_t> fold_cps;
+    std::vector<uint32_t> fold_ascii;
+    for (UChar32 c = 0x80; c <= MAX_CP; c++) {
+        UChar32 folded = u_foldCase(c, U_FOLD_CASE_DEFAULT);
+        if (folded < 0x80) {
+            fold_cps.push_back(c);
+            fold_ascii.push_back(folded);
+        }
+    }
+
+    UVersionInfo unicode;
+    u_getUnicodeVersion(unicode);
+    std::cout << "// generated by gen_unicode_tables from ICU " << U_ICU_VERSION
+              << " (Unicode " << (int)unicode[0] << "." << (int)unicode[1]
+              << "), do not edit\n"
+              << "#pragma once\n#include <cstdint>\n\n"
+              << "namespace bpecpp {\nnamespace unicode_tables {\n"
+              << "const int BLOCK_SHIFT = " << BLOCK_SHIFT << ";\n\n"
+              << "// the record of codepoint c is\n"
+              << "// RECORDS[BLOCK_DATA[BLOCKS[c >> BLOCK_SHIFT] << BLOCK_SHIFT |\n"
+              << "//                    (c & ((1 << BLOCK_SHIFT) - 1))]]\n";
+    print_array("uint16_t", "BLOCKS", blocks);
+    print_array("uint8_t", "BLOCK_DATA", block_data);
+    std::cout << "// general category numbered like ICU's UCharCategory in bits\n"
+              << "// 0-4, White_Space in bit 5, Alphabetic in bit 6, NFC_QC in\n"
+              << "// bits 7-8 (0 yes, 1 no, 2 maybe), canonical combining class\n"
+              << "// from bit 9\n";
+    print_array("uint32_t", "RECORDS", records);
+    std::cout << "// full canonical decomposition of DECOMP_CPS[i] is\n"
+              << "// DECOMP_DATA[DECOMP_START[i], DECOMP_START[i + 1]), Hangul\n"
+              << "// syllables excepted\n";
+    print_array("uint32_t", "DECOMP_CPS", decomp_cps);
+    print_array("uint16_t", "DECOMP_START", decomp_start);
+    print_array("uint32_t", "DECOMP_DATA", decomp_data);
+    std::cout << "// first << 21 | second for the pairs NFC composes, sorted,\n"
+              << "// and what they compose to. Hangul syllables excepted\n";
+    print_array("uint64_t", "COMPOSE_PAIRS", sorted_pairs);
+    print_array("uint32_t", "COMPOSE_RESULTS", sorted_results);
+    std::cout << "// codepoints outside ASCII whose simple case folding is ASCII\n";
+    print_array("uint32_t", "FOLD_CPS", fold_cps);
+    print_array("uint8_t", "FOLD_ASCII", fold_ascii);
+    std::cout << "}  // namespace unicode_tables\n}  // namespace bpecpp\n";
+    return 0;
+}
@@ -0,0 +1,548 @@
+#include "pretokenize.h"
+#include "unicode.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace bpecpp {
+const std::string BPE_PRETOK_REGEX =
+    R"('s|'t|'re|'ve|'m|'ll|'d| ?[[:alpha:]]+| ?[[:digit:]]+| ?[^\s[:alpha:][:digit:]]+|\s+(?!\S)|\s+)";
+const std::string GPT2_PRETOK_REGEX =
+    R"('s|'t|'re|'ve|'m|'ll|'d| ?\p{L}+| ?\p{N}+| ?[^\s\p{L}\p{N}]+|\s+(?!\S)|\s+)";
+const std::string CL100K_PRETOK_REGEX =
+    R"((?i:'s|'t|'re|'ve|'m|'ll|'d)|[^\r\n\p{L}\p{N}]?\p{L}+|\p{N}{1,3}| ?[^\s\p{L}\p{N}]+[\r\n]*|\s*[\r\n]+|\s+(?!\S)|\s+)";
+const std::string O200K_PRETOK_REGEX =
+    R"([^\r\n\p{L}\p{N}]?[\p{Lu}\p{Lt}\p{Lm}\p{Lo}\p{M}]*[\p{Ll}\p{Lm}\p{Lo}\p{M}]+(?i:'s|'t|'re|'ve|'m|'ll|'d)?|[^\r\n\p{L}\p{N}]?[\p{Lu}\p{Lt}\p{Lm}\p{Lo}\p{M}]+[\p{Ll}\p{Lm}\p{Lo}\p{M}]*(?i:'s|'t|'re|'ve|'m|'ll|'d)?|\p{N}{1,3}| ?[^\s\p{L}\p{N}]+[\r\n/]*|\s*[\r\n]+|\s+(?!\S)|\s+)";
+// how newer tiktoken spells cl100k_base, with possessive quantifiers that
+// never change what it matches
+static const std::string CL100K_PRETOK_REGEX_POSSESSIVE =
+    R"('(?i:[sdmt]|ll|ve|re)|[^\r\n\p{L}\p{N}]?+\p{L}+|\p{N}{1,3}| ?[^\s\p{L}\p{N}]++[\r\n]*|\s*[\r\n]|\s+(?!\S)|\s+)";
+
+pretokenizer_kind pretokenizer_for(const std::string& pattern) {
+    if (pattern == BPE_PRETOK_REGEX)
+        return pretokenizer_kind::gpt2;
+    if (pattern == GPT2_PRETOK_REGEX)
+        return pretokenizer_kind::gpt2_unicode;
+    if (pattern == CL100K_PRETOK_REGEX ||
+        pattern == CL100K_PRETOK_REGEX_POSSESSIVE)
+        return pretokenizer_kind::cl100k;
+    if (pattern == O200K_PRETOK_REGEX)
+        return pretokenizer_kind::o200k;
+    return pretokenizer_kind::regex;
+}
+
+// what BPE_PRETOK_REGEX's classes make of a codepoint. ICU's \s,
+// [[:alpha:]] and [[:digit:]] are the White_Space, Alphabetic and Nd
+// properties, which never overlap
+enum class pretok_class : uint8_t { space, alpha, digit, other };
+
+static pretok_class classify_cp(int32_t c) {
+    if (is_white_space(c))
+        return pretok_class::space;
+    if (is_alphabetic(c))
+        return pretok_class::alpha;
+    if (category_mask(c) & GC_ND)
+        return pretok_class::digit;
+    return pretok_class::other;
+}
+
+static pretok_class classify(int32_t c) {
+    static const std::array<pretok_class, 128> ascii = []() {
+        std::array<pretok_class, 128> table;
+        for (int32_t c = 0; c < 128; c++) {
+            table[c] = classify_cp(c);
+        }
+        return table;
+    }();
+    return c < 128 ? ascii[c] : classify_cp(c);
+}
+
+// codepoint at s[i], moving i past it. negative for invalid UTF-8
+static int32_t next_cp(const char* s, int32_t& i, int32_t len) {
+    return utf8_next(s, i, len);
+}
+
+// end of 's|'t|'re|'ve|'m|'ll|'d when s[i] follows an apostrophe, else 0
+static int32_t contraction_end(const char* s, int32_t i, int32_t len) {
+    if (s[i] == 's' || s[i] == 't' || s[i] == 'm' || s[i] == 'd')
+        return i + 1;
+    if (i + 1 < len &&
+        ((s[i] == 'r' && s[i + 1] == 'e') || (s[i] == 'v' && s[i + 1] == 'e') ||
+         (s[i] == 'l' && s[i + 1] == 'l')))
+        return i + 2;
+    return 0;
+}
+
+#if defined(__AVX2__)
+// lanes of v holding an ASCII byte of class cls
+static __m256i ascii_class_mask(__m256i v, pretok_class cls) {
+    __m256i lower = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+    __m256i alpha =
+        _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)),
+                         _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), lower));
+    __m256i digit =
+        _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8('0' - 1)),
+                         _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), v));
+    // \t \n \v \f \r and ' '
+    __m256i space = _mm256_or_si256(
+        _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')),
+        _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8('\t' - 1)),
+                         _mm256_cmpgt_epi8(_mm256_set1_epi8('\r' + 1), v)));
+    switch (cls) {
+        case pretok_class::alpha:
+            return alpha;
+        case pretok_class::digit:
+            return digit;
+        case pretok_class::space:
+            return space;
+        default:
+            // bytes from 0x80 up are negative
+            return _mm256_andnot_si256(
+                _mm256_or_si256(alpha, _mm256_or_si256(digit, space)),
+                _mm256_cmpgt_epi8(v, _mm256_set1_epi8(-1)));
+    }
+}
+#elif defined(__SSE2__)
+static __m128i ascii_class_mask(__m128i v, pretok_class cls) {
+    __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+    __m128i alpha =
+        _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                      _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1)));
+    __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)),
+                                  _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1)));
+    __m128i space = _mm_or_si128(
+        _mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+        _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('\t' - 1)),
+                      _mm_cmplt_epi8(v, _mm_set1_epi8('\r' + 1))));
+    switch (cls) {
+        case pretok_class::alpha:
+            return alpha;
+        case pretok_class::digit:
+            return digit;
+        case pretok_class::space:
+            return space;
+        default:
+            return _mm_andnot_si128(
+                _mm_or_si128(alpha, _mm_or_si128(digit, space)),
+                _mm_cmpgt_epi8(v, _mm_set1_epi8(-1)));
+    }
+}
+#endif
+
+// end of the run of ASCII bytes of class cls from s[i]. classifies a
+// vector of bytes at a time into a mask, stopping at the first byte of
+// another class or any byte of a multi-byte codepoint
+static int32_t ascii_run_end(const char* s,
+                             int32_t i,
+                             int32_t len,
+                             pretok_class cls) {
+#if defined(__AVX2__)
+    for (; i + 32 <= len; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(s + i));
+        uint32_t stop =
+            ~(uint32_t)_mm256_movemask_epi8(ascii_class_mask(v, cls));
+        if (stop)
+            return i + __builtin_ctz(stop);
+    }
+#elif defined(__SSE2__)
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(s + i));
+        uint32_t stop =
+            ~(uint32_t)_mm_movemask_epi8(ascii_class_mask(v, cls)) & 0xffff;
+        if (stop)
+            return i + __builtin_ctz(stop);
+    }
+#endif
+    while (i < len && (uint8_t)s[i] < 0x80 && classify(s[i]) == cls) {
+        i++;
+    }
+    return i;
+}
+
+// codepoint at s[i] without moving past it, next gets the index after it.
+// negative at the end of input and for invalid UTF-8
+static int32_t peek_cp(const char* s, int32_t i, int32_t len, int32_t& next) {
+    next = i;
+    return i < len ? next_cp(s, next, len) : -1;
+}
+
+// end of the run of codepoints from s[i] that pred accepts
+template <typename Pred>
+static int32_t run_end(const char* s, int32_t i, int32_t len, Pred pred) {
+    while (i < len) {
+        int32_t next = i;
+        if (!pred(next_cp(s, next, len)))
+            break;
+        i = next;
+    }
+    return i;
+}
+
+// run_end for a pred that accepts exactly the ASCII bytes of cls, skipping
+// those with ascii_run_end
+template <typename Pred>
+static int32_t fast_run_end(const char* s,
+                            int32_t i,
+                            int32_t len,
+                            pretok_class cls,
+                            Pred pred) {
+    while (i < len) {
+        i = ascii_run_end(s, i, len, cls);
+        if (i == len || (uint8_t)s[i] < 0x80)
+            break;
+        int32_t next = i;
+        if (!pred(next_cp(s, next, len)))
+            break;
+        i = next;
+    }
+    return i;
+}
+
+static bool is_newline(int32_t c) {
+    return c == '\r' || c == '\n';
+}
+
+static bool is_space(int32_t c) {
+    return c >= 0 && (c < 128 ? classify(c) == pretok_class::space
+                              : is_white_space(c));
+}
+
+// general category of c as a GC_* bit, 0 for invalid UTF-8
+static uint32_t category(int32_t c) {
+    static const std::array<uint32_t, 128> ascii = []() {
+        std::array<uint32_t, 128> table;
+        for (int32_t c = 0; c < 128; c++) {
+            table[c] = category_mask(c);
+        }
+        return table;
+    }();
+    if (c < 0)
+        return 0;
+    return c < 128 ? ascii[c] : category_mask(c);
+}
+
+static bool is_letter(int32_t c) {
+    return category(c) & GC_L;
+}
+
+static bool is_number(int32_t c) {
+    return category(c) & GC_N;
+}
+
+// [^\s\p{L}\p{N}]
+static bool is_punct(int32_t c) {
+    return c >= 0 && !is_space(c) &&
+           !(category(c) & (GC_L | GC_N));
+}
+
+// [^\r\n\p{L}\p{N}]
+static bool is_word_prefix(int32_t c) {
+    return c >= 0 && !is_newline(c) &&
+           !(category(c) & (GC_L | GC_N));
+}
+
+// [\p{Lu}\p{Lt}\p{Lm}\p{Lo}\p{M}] and [\p{Ll}\p{Lm}\p{Lo}\p{M}]
+static bool is_upper_run(int32_t c) {
+    return category(c) & (GC_LU | GC_LT | GC_LM | GC_LO | GC_M);
+}
+
+static bool is_lower_run(int32_t c) {
+    return category(c) & (GC_LL | GC_LM | GC_LO | GC_M);
+}
+
+// what GPT2_PRETOK_REGEX's classes make of a codepoint, which agrees
+// with classify on ASCII
+static pretok_class classify_unicode(int32_t c) {
+    if (is_space(c))
+        return pretok_class::space;
+    if (is_letter(c))
+        return pretok_class::alpha;
+    if (is_number(c))
+        return pretok_class::digit;
+    return pretok_class::other;
+}
+
+static bool is_newline_or_slash(int32_t c) {
+    return is_newline(c) || c == '/';
+}
+
+// end of (?i:'s|'t|'re|'ve|'m|'ll|'d) when s[i] follows an apostrophe,
+// else 0. besides ASCII case only U+017F folds onto one of the letters
+static int32_t contraction_end_ci(const char* s, int32_t i, int32_t len) {
+    int32_t next, after;
+    int32_t a = peek_cp(s, i, len, next);
+    a = a < 0 ? a : fold_case_ascii(a);
+    if (a == 's' || a == 't' || a == 'm' || a == 'd')
+        return next;
+    int32_t b = peek_cp(s, next, len, after);
+    b = b < 0 ? b : fold_case_ascii(b);
+    if ((a == 'r' && b == 'e') || (a == 'v' && b == 'e') ||
+        (a == 'l' && b == 'l'))
+        return after;
+    return 0;
+}
+
+// \p{N}{1,3} from s[i]
+static int32_t number_end(const char* s, int32_t i, int32_t len) {
+    int32_t end = i;
+    for (int n = 0; n < 3; n++) {
+        int32_t next;
+        if (!is_number(peek_cp(s, end, len, next)))
+            break;
+        end = next;
+    }
+    return end;
+}
+
+// the whitespace alternatives for a run starting at s[start]. with
+// newline_rule, \s*[\r\n]+ takes the run up to its last newline if it has
+// one. then \s+(?!\S) leaves the last space of a run followed by something
+// else for that, and \s+ takes a lone space
+static int32_t space_end(const char* s,
+                         int32_t start,
+                         int32_t len,
+                         bool newline_rule) {
+    int32_t i = start;
+    int32_t last = start;
+    int32_t newline_end = -1;
+    while (i < len) {
+        int32_t ascii_end = ascii_run_end(s, i, len, pretok_class::space);
+        if (ascii_end > i) {
+            for (int32_t k = ascii_end - 1; newline_rule && k >= i; k--) {
+                if (s[k] == '\r' || s[k] == '\n') {
+                    newline_end = k + 1;
+                    break;
+                }
+            }
+            last = ascii_end - 1;
+            i = ascii_end;
+        }
+        if (i == len || (uint8_t)s[i] < 0x80)
+            break;
+        int32_t next = i;
+        if (!is_space(next_cp(s, next, len)))
+            break;
+        last = i;
+        i = next;
+    }
+    if (newline_end >= 0)
+        return newline_end;
+    if (i < len && last > start)
+        return last;
+    return i;
+}
+
+// end of the BPE_PRETOK_REGEX match at s[start], -1 for invalid UTF-8.
+// with classify_unicode for Classify, of the GPT2_PRETOK_REGEX match
+template <pretok_class (*Classify)(int32_t)>
+static int32_t gpt2_end(const char* s, int32_t start, int32_t len) {
+    int32_t i = start;
+    int32_t c = next_cp(s, i, len);
+    if (c < 0)
+        return -1;
+    if (c == '\'' && i < len) {
+        int32_t end = contraction_end(s, i, len);
+        if (end)
+            return end;
+    }
+    pretok_class cls = Classify(c);
+    // the optional space in front of the three runs below
+    if (c == ' ') {
+        int32_t next;
+        int32_t c2 = peek_cp(s, i, len, next);
+        if (c2 >= 0 && Classify(c2) != pretok_class::space) {
+            cls = Classify(c2);
+            i = next;
+        }
+    }
+    if (cls == pretok_class::space) {
+        // \s+(?!\S)|\s+
+        return space_end(s, start, len, false);
+    }
+    //  ?[[:alpha:]]+| ?[[:digit:]]+| ?[^\s[:alpha:][:digit:]]+
+    return fast_run_end(s, i, len, cls, [cls](int32_t c2) {
+        return c2 >= 0 && Classify(c2) == cls;
+    });
+}
+
+// end of the CL100K_PRETOK_REGEX match at s[start], -1 for invalid UTF-8
+static int32_t cl100k_end(const char* s, int32_t start, int32_t len) {
+    int32_t i = start;
+    int32_t c = next_cp(s, i, len);
+    if (c < 0)
+        return -1;
+    // (?i:'s|'t|'re|'ve|'m|'ll|'d)
+    if (c == '\'') {
+        int32_t end = contraction_end_ci(s, i, len);
+        if (end)
+            return end;
+    }
+    // [^\r\n\p{L}\p{N}]?\p{L}+
+    if (is_letter(c))
+        return fast_run_end(s, i, len, pretok_class::alpha, is_letter);
+    // \p{N}{1,3}
+    if (is_number(c))
+        return number_end(s, start, len);
+    int32_t next;
+    int32_t c2 = peek_cp(s, i, len, next);
+    if (!is_newline(c) && is_letter(c2))
+        return fast_run_end(s, next, len, pretok_class::alpha, is_letter);
+    //  ?[^\s\p{L}\p{N}]+[\r\n]*
+    if (is_punct(c) || (c == ' ' && is_punct(c2))) {
+        int32_t end = fast_run_end(s, is_punct(c) ? i : next, len,
+                                   pretok_class::other, is_punct);
+        return run_end(s, end, len, is_newline);
+    }
+    // \s*[\r\n]+|\s+(?!\S)|\s+
+    return space_end(s, start, len, true);
+}
+
+// [\p{Lu}\p{Lt}\p{Lm}\p{Lo}\p{M}]*[\p{Ll}\p{Lm}\p{Lo}\p{M}]+ from s[i], -1
+// if it does not match
+static int32_t o200k_lower_word(const char* s, int32_t i, int32_t len) {
+    // just past the last codepoint of the first run that is in both
+    // classes, where backtracking the first run would end the match
+    int32_t both_end = -1;
+    while (i < len) {
+        int32_t next;
+        int32_t c = peek_cp(s, i, len, next);
+        if (!is_upper_run(c))
+            break;
+        if (is_lower_run(c))
+            both_end = next;
+        i = next;
+    }
+    int32_t next;
+    if (is_lower_run(peek_cp(s, i, len, next)))
+        return run_end(s, i, len, is_lower_run);
+    return both_end;
+}
+
+// [\p{Lu}\p{Lt}\p{Lm}\p{Lo}\p{M}]+[\p{Ll}\p{Lm}\p{Lo}\p{M}]* from s[i], -1
+// if it does not match
+static int32_t o200k_upper_word(const char* s, int32_t i, int32_t len) {
+    int32_t end = run_end(s, i, len, is_upper_run);
+    return end == i ? -1 : run_end(s, end, len, is_lower_run);
+}
+
+// the two word alternatives of O200K_PRETOK_REGEX at s[start], each tried
+// with and then without its optional prefix, plus the optional
+// contraction after them. -1 if neither matches
+static int32_t o200k_word(const char* s, int32_t start, int32_t len) {
+    int32_t after_prefix;
+    bool prefix = is_word_prefix(peek_cp(s, start, len, after_prefix));
+    int32_t (*const words[])(const char*, int32_t, int32_t) = {
+        o200k_lower_word, o200k_upper_word};
+    for (auto word : words) {
+        int32_t end = prefix ? word(s, after_prefix, len) : -1;
+        if (end < 0)
+            end = word(s, start, len);
+        if (end < 0)
+            continue;
+        if (end < len && s[end] == '\'') {
+            int32_t contraction = contraction_end_ci(s, end + 1, len);
+            if (contraction)
+                end = contraction;
+        }
+        return end;
+    }
+    return -1;
+}
+
+// end of the O200K_PRETOK_REGEX match at s[start], -1 for invalid UTF-8
+static int32_t o200k_end(const char* s, int32_t start, int32_t len) {
+    int32_t i = start;
+    int32_t c = next_cp(s, i, len);
+    if (c < 0)
+        return -1;
+    int32_t end = o200k_word(s, start, len);
+    if (end >= 0)
+        return end;
+    // \p{N}{1,3}
+    if (is_number(c))
+        return number_end(s, start, len);
+    //  ?[^\s\p{L}\p{N}]+[\r\n/]*
+    int32_t next;
+    int32_t c2 = peek_cp(s, i, len, next);
+    if (is_punct(c) || (c == ' ' && is_punct(c2))) {
+        end = fast_run_end(s, is_punct(c) ? i : next, len,
+                           pretok_class::other, is_punct);
+        return run_end(s, end, len, is_newline_or_slash);
+    }
+    // \s*[\r\n]+|\s+(?!\S)|\s+
+    return space_end(s, start, len, true);
+}
+
+pretoken_scanner::pretoken_scanner(pretokenizer_kind kind,
+                                   const char* data,
+                                   size_t size)
+    : m_data(data), m_size((int32_t)size) {
+    switch (kind) {
+        case pretokenizer_kind::gpt2:
+            m_end = gpt2_end<classify>;
+            break;
+        case pretokenizer_kind::gpt2_unicode:
+            m_end = gpt2_end<classify_unicode>;
+            break;
+        case pretokenizer_kind::cl100k:
+            m_end = cl100k_end;
+            break;
+        case pretokenizer_kind::o200k:
+            m_end = o200k_end;
+            break;
+        default:
+            throw std::runtime_error("No pretoken scanner for this pattern");
+    }
+}
+
+bool pretoken_scanner::next(byte_span& pretok) {
+    if (m_pos >= m_size || m_invalid)
+        return false;
+    int32_t end = m_end(m_data, m_pos, m_size);
+    if (end < 0) {
+        m_invalid = true;
+        return false;
+    }
+    pretok = byte_span(m_data + m_pos, end - m_pos);
+    m_pos = end;
+    return true;
+}
+
+size_t pretoken_cut(const char* s, size_t len, size_t from) {
+    // every pretoken with a space inside starts with it or is all
+    // whitespace, so one ends before the space. ASCII on either side
+    // keeps the cut on an NFC boundary
+    for (size_t i = std::max<size_t>(from, 1); i < len; i++) {
+        const char* space = (const char*)memchr(s + i, ' ', len - i);
+        if (!space)
+            break;
+        i = space - s;
+        uint8_t prev = (uint8_t)s[i - 1];
+        if (prev < 0x80 && classify(prev) != pretok_class::space)
+            return i;
+    }
+    return len;
+}
+
+bool scan_pretokens(pretokenizer_kind kind,
+                    const std::string& input,
+                    std::vector<std::string>& pretoks) {
+    if (kind == pretokenizer_kind::regex)
+        return false;
+    pretoken_scanner scanner(kind, input.data(), input.size());
+    byte_span pretok;
+    while (scanner.next(pretok)) {
+        pretoks.emplace_back(pretok.data(), pretok.size());
+    }
+    return !scanner.invalid();
+}
+}  // namespace bpecpp
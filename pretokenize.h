@@ -0,0 +1,78 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace bpecpp {
+// GPT-2's pretokenizer pattern, the default
+extern const std::string BPE_PRETOK_REGEX;
+// the same with \p{L} and \p{N} for [[:alpha:]] and [[:digit:]], as
+// tokenizer.json's ByteLevel pre_tokenizer spells it. the two differ on
+// marks that are Alphabetic and on numbers other than Nd
+extern const std::string GPT2_PRETOK_REGEX;
+// cl100k_base's, which Llama 3 uses as well
+extern const std::string CL100K_PRETOK_REGEX;
+extern const std::string O200K_PRETOK_REGEX;
+
+// how text is split into pretokens before merging
+enum class pretokenizer_kind {
+    // hand-written scanners for the patterns above
+    gpt2,
+    gpt2_unicode,
+    cl100k,
+    o200k,
+    // any other pattern, run by the ICU regex engine
+    regex,
+};
+
+// the scanner that splits text exactly like pattern, regex if none does
+pretokenizer_kind pretokenizer_for(const std::string& pattern);
+
+// bytes of a pretoken, pointing into the text it was cut from
+struct byte_span {
+    const char* ptr = nullptr;
+    size_t len = 0;
+
+    byte_span() {}
+    byte_span(const char* ptr, size_t len) : ptr(ptr), len(len) {}
+    byte_span(const std::string& s) : ptr(s.data()), len(s.size()) {}
+
+    const char* data() const { return ptr; }
+    size_t size() const { return len; }
+    const char* begin() const { return ptr; }
+    const char* end() const { return ptr + len; }
+    char operator[](size_t i) const { return ptr[i]; }
+};
+
+// yields the pretokens of a text one at a time, without copying them.
+// the text has to outlive the scanner and the spans it hands out
+class pretoken_scanner {
+   public:
+    // kind must not be pretokenizer_kind::regex
+    pretoken_scanner(pretokenizer_kind kind, const char* data, size_t size);
+
+    // the next pretoken, false at the end of the text or at invalid UTF-8
+    bool next(byte_span& pretok);
+    // whether next stopped early because of invalid UTF-8
+    bool invalid() const { return m_invalid; }
+
+   private:
+    int32_t (*m_end)(const char*, int32_t, int32_t);
+    const char* m_data;
+    int32_t m_size;
+    int32_t m_pos = 0;
+    bool m_invalid = false;
+};
+
+// first index at or after from where s can be cut in two without changing
+// how either part is pretokenized or NFC normalized: a space following an
+// ASCII character other than whitespace. len if there is none
+size_t pretoken_cut(const char* s, size_t len, size_t from);
+
+// splits input with the scanner for kind, appending the raw bytes of each
+// pretoken. false if input is not valid UTF-8
+bool scan_pretokens(pretokenizer_kind kind,
+                    const std::string& input,
+                    std::vector<std::string>& pretoks);
+}  // namespace bpecpp
@@ -0,0 +1,196 @@
+// checks what unicode.cpp computes from unicode_tables.h against the ICU
+// the tables were generated from, so they can be regenerated safely. built
+// with ICU, but with unicode.cpp compiled as for BPECPP_USE_ICU=OFF
+#include <unicode/normalizer2.h>
+#include <unicode/uchar.h>
+#include <unicode/unistr.h>
+#include <unicode/utf8.h>
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "unicode.h"
+
+static const UChar32 MAX_CP = 0x10ffff;
+
+static bool is_surrogate(UChar32 c) {
+    return c >= 0xd800 && c < 0xe000;
+}
+
+static std::string utf8(const std::vector<UChar32>& cps) {
+    std::string s;
+    for (UChar32 c : cps) {
+        bpecpp::append_utf8(s, c);
+    }
+    return s;
+}
+
+// counts and prints the first few failures of a check
+class failures {
+   public:
+    explicit failures(const char* what) : m_what(what) {}
+    void add(const std::string& detail) {
+        if (m_count++ < 10)
+            std::cerr << m_what << " differs from ICU: " << detail
+                      << std::endl;
+    }
+    size_t count() const { return m_count; }
+
+   private:
+    const char* m_what;
+    size_t m_count = 0;
+};
+
+static std::string hex(const std::string& s) {
+    static const char digits[] = "0123456789abcdef";
+    std::string out;
+    for (char c : s) {
+        out += "\\x";
+        out += digits[(uint8_t)c >> 4];
+        out += digits[(uint8_t)c & 15];
+    }
+    return out;
+}
+
+static size_t check_properties() {
+    failures fail("property");
+    for (UChar32 c = 0; c <= MAX_CP; c++) {
+        UChar32 folded = u_foldCase(c, U_FOLD_CASE_DEFAULT);
+        if (bpecpp::category_mask(c) != U_GET_GC_MASK(c) ||
+            bpecpp::is_white_space(c) != (bool)u_isUWhiteSpace(c) ||
+            bpecpp::is_alphabetic(c) != (bool)u_isUAlphabetic(c) ||
+            bpecpp::fold_case_ascii(c) != (folded < 0x80 ? folded : c))
+            fail.add("U+" + std::to_string(c));
+    }
+    return fail.count();
+}
+
+// every string of one to three bytes and random longer ones, decoded a
+// codepoint at a time, and their U+FFFD replacement
+static size_t check_utf8() {
+    failures fail("UTF-8 decoding");
+    auto check = [&](const std::string& s) {
+        int32_t len = (int32_t)s.size();
+        for (int32_t i = 0, j = 0; i < len;) {
+            UChar32 expected;
+            U8_NEXT(s.data(), j, len, expected);
+            int32_t c = bpecpp::utf8_next(s.data(), i, len);
+            if (c != expected || i != j) {
+                fail.add(hex(s));
+                return;
+            }
+        }
+        std::string replaced, expected;
+        bpecpp::replace_invalid_utf8(s.data(), s.size(), replaced);
+        icu::UnicodeString::fromUTF8(s).toUTF8String(expected);
+        if (replaced != expected ||
+            bpecpp::is_valid_utf8(s.data(), s.size()) != (s == expected))
+            fail.add(hex(s));
+    };
+    std::string s;
+    for (uint32_t n = 0; n < 256 + 65536 + (1 << 24); n++) {
+        size_t len = n < 256 ? 1 : n < 256 + 65536 ? 2 : 3;
+        uint32_t bits = n < 256 ? n : n < 256 + 65536 ? n - 256 : n - 65792;
+        s.clear();
+        for (size_t k = 0; k < len; k++) {
+            s += (char)(bits >> (8 * k));
+        }
+        check(s);
+    }
+    // mostly lead and trail bytes, so that long sequences come up
+    static const uint8_t bytes[] = {0x00, 0x41, 0x7f, 0x80, 0x8f, 0x90,
+                                    0x9f, 0xa0, 0xbf, 0xc0, 0xc1, 0xc2,
+                                    0xdf, 0xe0, 0xe1, 0xed, 0xee, 0xef,
+                                    0xf0, 0xf1, 0xf4, 0xf5, 0xfe, 0xff};
+    std::mt19937 rng(1);
+    for (int i = 0; i < 1000000; i++) {
+        s.clear();
+        size_t len = 1 + rng() % 12;
+        for (size_t k = 0; k < len; k++) {
+            s += (char)(rng() % 2 ? bytes[rng() % sizeof(bytes)] : rng());
+        }
+        check(s);
+    }
+    return fail.count();
+}
+
+static size_t check_nfc() {
+    UErrorCode uerror = U_ZERO_ERROR;
+    const icu::Normalizer2* nfc = icu::Normalizer2::getNFCInstance(uerror);
+    if (!U_SUCCESS(uerror)) {
+        std::cerr << "could not get ICU NFC normalizer" << std::endl;
+        return 1;
+    }
+    failures fail("NFC");
+    auto check = [&](const std::string& s) {
+        std::string normalized, expected;
+        bpecpp::byte_span out = bpecpp::normalize_nfc(s, normalized);
+        UErrorCode uerror = U_ZERO_ERROR;
+        nfc->normalize(icu::UnicodeString::fromUTF8(s), uerror)
+            .toUTF8String(expected);
+        if (!U_SUCCESS(uerror) ||
+            std::string(out.data(), out.size()) != expected)
+            fail.add(hex(s));
+    };
+    // the codepoints NFC does something with, to draw from
+    std::vector<UChar32> special;
+    for (UChar32 c = 0x80; c <= MAX_CP; c++) {
+        if (is_surrogate(c))
+            continue;
+        if (!nfc->isInert(c) || u_getCombiningClass(c))
+            special.push_back(c);
+    }
+    // every codepoint alone, after a starter, before a combining mark and
+    // after a Hangul leading consonant
+    for (UChar32 c = 0; c <= MAX_CP; c++) {
+        if (is_surrogate(c))
+            continue;
+        check(utf8({c}));
+        check(utf8({'a', c}));
+        check(utf8({c, 0x0301}));
+        check(utf8({0x1100, c}));
+    }
+    std::mt19937 rng(1);
+    std::vector<UChar32> cps;
+    for (int i = 0; i < 2000000; i++) {
+        cps.clear();
+        size_t len = 1 + rng() % 8;
+        for (size_t k = 0; k < len; k++) {
+            UChar32 c;
+            switch (rng() % 4) {
+                case 0:
+                    c = 'a' + rng() % 26;
+                    break;
+                case 1:
+                    c = rng() % (MAX_CP + 1);
+                    if (is_surrogate(c))
+                        c = 0xfffd;
+                    break;
+                default:
+                    c = special[rng() % special.size()];
+                    break;
+            }
+            cps.push_back(c);
+        }
+        check(utf8(cps));
+    }
+    return fail.count();
+}
+
+int main() {
+    size_t properties = check_properties();
+    size_t utf8 = check_utf8();
+    size_t nfc = check_nfc();
+    std::cerr << "differences from ICU " << U_ICU_VERSION << ": properties "
+              << properties << ", UTF-8 " << utf8 << ", NFC " << nfc
+              << std::endl;
+    if (properties || utf8 || nfc) {
+        std::cerr << "regenerate unicode_tables.h with gen_unicode_tables"
+                  << std::endl;
+        return 1;
+    }
+    return 0;
+}
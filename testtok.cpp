@@ -1,16 +1,685 @@
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <iterator>
+#include <map>
+#include <numeric>
+#include <random>
 
 #include "bpe.h"
 #include "json.hpp"
+#include "unicode.h"
 
 using json = nlohmann::json;
 
+// raw bytes spelled in the byte alphabet of vocab and merges
+static std::string to_alphabet(const std::string& bytes) {
+    static const bpecpp::bpe_char_byte_table table;
+    std::string s;
+    for (char c : bytes) {
+        bpecpp::append_utf8(s, table.byte_to_codepoint((uint8_t)c));
+    }
+    return s;
+}
+
+typedef std::vector<std::pair<std::string, std::string>> merge_list;
+
+// a vocab of every byte outside of missing, with the byte as its id, then
+// the tokens merges build in order. merges and vocab are raw bytes
+static std::unordered_map<std::string, uint32_t> make_vocab(
+    const merge_list& merges,
+    const std::string& missing) {
+    std::unordered_map<std::string, uint32_t> vocab;
+    for (int byte = 0; byte < 256; byte++) {
+        if (missing.find((char)byte) == std::string::npos)
+            vocab[std::string(1, (char)byte)] = byte;
+    }
+    for (size_t i = 0; i < merges.size(); i++) {
+        vocab.emplace(merges[i].first + merges[i].second, (uint32_t)(256 + i));
+    }
+    return vocab;
+}
+
+static bpecpp::BPE make_bpe(
+    const merge_list& merges,
+    const std::string& missing,
+    const bpecpp::bpe_options& options = bpecpp::bpe_options()) {
+    std::unordered_map<std::string, uint32_t> vocab;
+    for (auto& tok : make_vocab(merges, missing)) {
+        vocab[to_alphabet(tok.first)] = tok.second;
+    }
+    std::vector<std::string> rules;
+    for (auto& merge : merges) {
+        rules.push_back(to_alphabet(merge.first) + " " +
+                        to_alphabet(merge.second));
+    }
+    return bpecpp::BPE(vocab, rules, options);
+}
+
+static const bpecpp::bpe_engine ENGINES[] = {
+    bpecpp::bpe_engine::naive, bpecpp::bpe_engine::heap,
+    bpecpp::bpe_engine::backtrack, bpecpp::bpe_engine::rank_array,
+    bpecpp::bpe_engine::adaptive};
+
+// bytes without a token stay one symbol each and encode as 0
+static bool test_missing_bytes() {
+    bpecpp::BPE bpe = make_bpe({{"t", "h"}, {"th", "e"}},
+                               "\x01\x02\x03\x04\x05\x06\x07\x08");
+    const uint32_t the = 257;
+    bool ok = true;
+    for (auto lookup : {bpecpp::merge_lookup::hashed,
+                        bpecpp::merge_lookup::csr}) {
+        bpe.set_merge_lookup(lookup);
+        for (auto engine : ENGINES) {
+            bpe.set_engine(engine);
+            std::vector<uint32_t> expected = {'a', 'b', 0,   0,
+                                              'c', 'd', ' ', the};
+            // a pretoken where one merges next to a missing byte
+            std::vector<uint32_t> merged;
+            bpe.encode_pretoken("\x01the", merged);
+            if (bpe.encode("ab\x01\x02" "cd the") != expected ||
+                merged != std::vector<uint32_t>{bpecpp::BPE_NO_TOKEN, the}) {
+                std::cerr << "missing bytes misencoded by engine "
+                          << (int)engine << " with lookup " << (int)lookup
+                          << std::endl;
+                ok = false;
+            }
+        }
+    }
+    return ok;
+}
+
+// random text for training and encoding, with words, several scripts,
+// bytes the vocab may lack and runs of one byte of up to max_run
+static std::string random_words(std::mt19937& rng,
+                                size_t pieces,
+                                size_t max_run) {
+    static const char* words[] = {
+        "the", "of", "and", "token", "tokens", "merge", "merges", "byte",
+        "Hello", "WORLD", "it's", "we're", "0", "7", "42", "1999", ",", ".",
+        "!?", "(", ")", "\xe4\xb8\xad\xe6\x96\x87", "\xe6\x97\xa5\xe6\x9c\xac",
+        "\xe3\x81\x93\xe3\x82\x93\xe3\x81\xab\xe3\x81\xa1\xe3\x81\xaf",
+        "\xe3\x81\x82", "\xe3\x81\x84\xe3\x81\x86", "\xc3\xa9t\xc3\xa9",
+        "na\xc3\xafve", "\xd0\xbc\xd0\xb8\xd1\x80", "\xf0\x9f\xa4\x96",
+        "\xf0\x9f\x98\x80\xf0\x9f\x98\x80", "\x01", "\x02\x03", "the\x04",
+        "\x05\x06\x07\x08", "\xff", "\t", "\n", "\r\n"};
+    static const char runs[] = {' ', '\n', '=', '-', '0', '9', 'a', '\x01'};
+    std::string text;
+    for (size_t i = 0; i < pieces; i++) {
+        if (rng() % 16 == 0) {
+            size_t len = 2 + rng() % (rng() % 4 ? 40 : max_run - 1);
+            text.append(len, runs[rng() % sizeof(runs)]);
+            continue;
+        }
+        if (rng() % 2)
+            text += ' ';
+        text += words[rng() % (sizeof(words) / sizeof(words[0]))];
+    }
+    return text;
+}
+
+// merges learned from text the way BPE is trained: the most frequent
+// pair of adjacent symbols within a pretoken merges first
+static merge_list train_merges(const std::string& text, size_t count) {
+    bpecpp::BPE splitter({}, {});
+    std::map<std::vector<std::string>, size_t> words;
+    for (auto& pretoken : splitter.pretokenize(text)) {
+        std::vector<std::string> symbols;
+        for (char c : pretoken) {
+            symbols.push_back(std::string(1, c));
+        }
+        words[symbols]++;
+    }
+    merge_list merges;
+    while (merges.size() < count) {
+        std::map<std::pair<std::string, std::string>, size_t> pairs;
+        for (auto& word : words) {
+            for (size_t i = 0; i + 1 < word.first.size(); i++) {
+                pairs[{word.first[i], word.first[i + 1]}] += word.second;
+            }
+        }
+        auto best = pairs.end();
+        for (auto it = pairs.begin(); it != pairs.end(); it++) {
+            if (best == pairs.end() || it->second > best->second)
+                best = it;
+        }
+        if (best == pairs.end() || best->second < 2)
+            break;
+        merges.push_back(best->first);
+        std::map<std::vector<std::string>, size_t> merged;
+        for (auto& word : words) {
+            std::vector<std::string> symbols;
+            for (size_t i = 0; i < word.first.size(); i++) {
+                if (i + 1 < word.first.size() &&
+                    word.first[i] == best->first.first &&
+                    word.first[i + 1] == best->first.second) {
+                    symbols.push_back(word.first[i] + word.first[i + 1]);
+                    i++;
+                } else {
+                    symbols.push_back(word.first[i]);
+                }
+            }
+            merged[symbols] += word.second;
+        }
+        words.swap(merged);
+    }
+    return merges;
+}
+
+// BPE the way minGPT does it, on strings: every pretoken starts as its
+// bytes and the lowest ranked pair of adjacent symbols merges everywhere
+// until none is left. symbols missing from the vocab encode as 0
+static std::vector<uint32_t> reference_encode(const std::string& text,
+                                              const merge_list& merges,
+                                              const std::string& missing) {
+    auto vocab = make_vocab(merges, missing);
+    std::map<std::pair<std::string, std::string>, size_t> ranks;
+    for (size_t i = 0; i < merges.size(); i++) {
+        // a rule with a part missing from the vocab never applies
+        if (vocab.count(merges[i].first) && vocab.count(merges[i].second))
+            ranks.emplace(merges[i], i);
+    }
+    bpecpp::BPE splitter({}, {});
+    std::vector<uint32_t> out;
+    for (auto& pretoken : splitter.pretokenize(text)) {
+        std::vector<std::string> symbols;
+        for (char c : pretoken) {
+            symbols.push_back(std::string(1, c));
+        }
+        while (true) {
+            auto best = ranks.end();
+            for (size_t i = 0; i + 1 < symbols.size(); i++) {
+                auto it = ranks.find({symbols[i], symbols[i + 1]});
+                if (it != ranks.end() &&
+                    (best == ranks.end() || it->second < best->second))
+                    best = it;
+            }
+            if (best == ranks.end())
+                break;
+            std::vector<std::string> merged;
+            for (size_t i = 0; i < symbols.size(); i++) {
+                if (i + 1 < symbols.size() && symbols[i] == best->first.first &&
+                    symbols[i + 1] == best->first.second) {
+                    merged.push_back(symbols[i] + symbols[i + 1]);
+                    i++;
+                } else {
+                    merged.push_back(symbols[i]);
+                }
+            }
+            symbols.swap(merged);
+        }
+        for (auto& symbol : symbols) {
+            auto it = vocab.find(symbol);
+            out.push_back(it != vocab.end() ? it->second : 0);
+        }
+    }
+    return out;
+}
+
+// every engine, merge lookup, renumbering and seeding has to encode like the
+// reference, with all bytes in the vocab and without some
+// merge_trace() counts a merge for every two symbols that became one, so
+// a pretoken of n bytes encoded as k tokens adds n - k to its total.
+// returns the pretokens of the first few inputs where it does not
+static size_t trace_mismatches(bpecpp::BPE& bpe,
+                               const std::vector<std::string>& inputs) {
+    size_t failures = 0;
+    uint64_t traced = 0;
+    std::vector<uint32_t> tokens;
+    bpe.set_merge_trace(true);
+    for (size_t i = 0; i < inputs.size() && i < 20; i++) {
+        for (auto& pretok : bpe.pretokenize(inputs[i])) {
+            tokens.clear();
+            bpe.encode_pretoken(pretok, tokens);
+            const std::vector<uint64_t>& trace = bpe.merge_trace();
+            uint64_t total =
+                std::accumulate(trace.begin(), trace.end(), (uint64_t)0);
+            if (total - traced != pretok.size() - tokens.size())
+                failures++;
+            traced = total;
+        }
+    }
+    bpe.set_merge_trace(false);
+    return failures;
+}
+
+static bool test_engines() {
+    std::mt19937 rng(2);
+    std::string sample = random_words(rng, 5000, 40);
+    auto merges = train_merges(sample, 600);
+    // runs far longer than any token, which the run tables answer
+    std::vector<std::string> inputs;
+    for (int i = 0; i < 300; i++) {
+        inputs.push_back(random_words(rng, 1 + rng() % 60, 1200));
+    }
+    bool ok = true;
+    for (const char* missing : {"", "\x01\x02\x03\x04\x05\x06\x07\x08"}) {
+        std::vector<std::vector<uint32_t>> expected;
+        for (auto& input : inputs) {
+            expected.push_back(reference_encode(input, merges, missing));
+        }
+        // the rules the sample applies, for the hot table
+        bpecpp::BPE tracer = make_bpe(merges, missing);
+        tracer.set_merge_trace(true);
+        tracer.encode(sample);
+        // renumbered by the counts of the sample, then also with a table
+        // of the most applied rules
+        bpecpp::bpe_options renumbered;
+        renumbered.frequency_sample = sample;
+        bpecpp::bpe_options hot = renumbered;
+        hot.merge_counts = tracer.merge_trace();
+        hot.hot_merges = 64;
+        // starting from the tokens of characters rather than their bytes
+        bpecpp::bpe_options seeded;
+        seeded.seed_characters = true;
+        const char* option_names[] = {"plain", "renumbered", "hot", "seeded"};
+        bpecpp::bpe_options option_sets[] = {bpecpp::bpe_options(),
+                                             renumbered, hot, seeded};
+        for (int o = 0; o < 4; o++) {
+            bpecpp::BPE bpe = make_bpe(merges, missing, option_sets[o]);
+            for (auto lookup : {bpecpp::merge_lookup::hashed,
+                                bpecpp::merge_lookup::csr}) {
+                bpe.set_merge_lookup(lookup);
+                for (auto engine : ENGINES) {
+                    bpe.set_engine(engine);
+                    // adaptive once more with the vector lanes, which an
+                    // AVX2 build has
+                    for (size_t lanes_max : {0, 16}) {
+                        if (lanes_max &&
+                            engine != bpecpp::bpe_engine::adaptive)
+                            continue;
+                        bpecpp::adaptive_thresholds thresholds;
+                        thresholds.lanes_max = lanes_max;
+                        bpe.set_adaptive_thresholds(thresholds);
+                        size_t failures = 0;
+                        for (size_t i = 0; i < inputs.size(); i++) {
+                            if (bpe.encode(inputs[i]) != expected[i] &&
+                                failures++ < 3)
+                                std::cerr
+                                    << "engine mismatch on: "
+                                    << json(inputs[i]).dump(
+                                           -1, ' ', false,
+                                           json::error_handler_t::replace)
+                                    << std::endl;
+                        }
+                        if (failures) {
+                            std::cerr << failures << " mismatches of engine "
+                                      << (int)engine << " with lookup "
+                                      << (int)lookup << ", lanes_max "
+                                      << lanes_max << ", " << option_names[o]
+                                      << ", " << strlen(missing)
+                                      << " bytes missing" << std::endl;
+                            ok = false;
+                        }
+                    }
+                    size_t traces = trace_mismatches(bpe, inputs);
+                    if (traces) {
+                        std::cerr << traces << " merge traces of engine "
+                                  << (int)engine << " with lookup "
+                                  << (int)lookup << ", " << option_names[o]
+                                  << ", " << strlen(missing)
+                                  << " bytes missing do not add up"
+                                  << std::endl;
+                        ok = false;
+                    }
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+// with ignore_merges a pretoken equal to a token no merges build still
+// becomes it, also where one token is another plus zero bytes
+static bool test_ignore_merges() {
+    const std::string tokens[] = {
+        "xy", std::string("xy\0", 3), std::string("x\0\0", 3),
+        std::string(7, '\xff'), std::string(8, '\xff'), "abcdefgh",
+        std::string("abcdefgh\0", 9)};
+    std::unordered_map<std::string, uint32_t> vocab;
+    for (auto& tok : make_vocab({}, "")) {
+        vocab[to_alphabet(tok.first)] = tok.second;
+    }
+    for (size_t i = 0; i < sizeof(tokens) / sizeof(tokens[0]); i++) {
+        vocab[to_alphabet(tokens[i])] = (uint32_t)(300 + i);
+    }
+    bpecpp::bpe_options options;
+    options.ignore_merges = true;
+    bpecpp::BPE bpe(vocab, {}, options);
+    bool ok = true;
+    for (auto engine : ENGINES) {
+        bpe.set_engine(engine);
+        for (size_t i = 0; i < sizeof(tokens) / sizeof(tokens[0]); i++) {
+            std::vector<uint32_t> out;
+            bpe.encode_pretoken(tokens[i], out);
+            if (out != std::vector<uint32_t>{(uint32_t)(300 + i)}) {
+                std::cerr << "ignore_merges missed token " << 300 + i
+                          << " with engine " << (int)engine << std::endl;
+                ok = false;
+            }
+        }
+    }
+    return ok;
+}
+
+// bpe_options::max_pretoken_bytes cuts long pretokens into pieces merged
+// on their own, at the start of a UTF-8 character, and the regex limits
+// stop a runaway pattern
+static bool test_limits() {
+    bool ok = true;
+    // every prefix of the alphabet, and each character then the first two
+    merge_list merges;
+    std::string prefix = "a";
+    for (char c = 'b'; c <= 'j'; c++) {
+        merges.push_back({prefix, std::string(1, c)});
+        prefix += c;
+    }
+    const char* han[] = {"\xe4\xb8\xad", "\xe6\x96\x87", "\xe6\x97\xa5",
+                         "\xe6\x9c\xac", "\xe8\xaa\x9e"};
+    for (const char* c : han) {
+        merges.push_back({std::string(c, 1), std::string(c + 1, 1)});
+        merges.push_back({std::string(c, 2), std::string(c + 2, 1)});
+    }
+    merges.push_back({han[0], han[1]});
+    auto vocab = make_vocab(merges, "");
+    bpecpp::bpe_options options;
+    options.max_pretoken_bytes = 4;
+    bpecpp::BPE unlimited = make_bpe(merges, "");
+    bpecpp::BPE limited = make_bpe(merges, "", options);
+    std::string text = "abcdefghij";
+    std::vector<uint32_t> whole = {vocab.at(text)};
+    std::vector<uint32_t> cut = {vocab.at("abcd"), 'e', 'f', 'g', 'h', 'i',
+                                 'j'};
+    std::string chars;
+    std::vector<uint32_t> char_tokens;
+    for (const char* c : han) {
+        chars += c;
+        char_tokens.push_back(vocab.at(c));
+    }
+    std::vector<uint32_t> joined = char_tokens;
+    joined.erase(joined.begin());
+    joined[0] = vocab.at(std::string(han[0]) + han[1]);
+    if (unlimited.encode(text) != whole || limited.encode(text) != cut ||
+        unlimited.encode(chars) != joined ||
+        limited.encode(chars) != char_tokens) {
+        std::cerr << "max_pretoken_bytes cut in the wrong place" << std::endl;
+        ok = false;
+    }
+    // a cut backs up as much as 3 bytes, so fewer than 4 are refused
+    options.max_pretoken_bytes = 3;
+    try {
+        make_bpe(merges, "", options);
+        std::cerr << "max_pretoken_bytes = 3 was accepted" << std::endl;
+        ok = false;
+    } catch (const std::runtime_error&) {
+    }
+#ifndef BPECPP_NO_ICU
+    // backtracks exponentially on a run of letters without a '!'
+    bpecpp::bpe_options regex_options;
+    regex_options.pretokenizer_regex = "(?:\\p{L}+)+!|\\s+|.";
+    regex_options.regex_time_limit = 100;
+    bpecpp::BPE backtracking = make_bpe({}, "", regex_options);
+    try {
+        backtracking.encode(std::string(64, 'a'));
+        std::cerr << "the regex time limit did not hit" << std::endl;
+        ok = false;
+    } catch (const bpecpp::bpe_limit_error&) {
+    }
+    // the matcher this thread keeps still works after that
+    if (backtracking.encode("ab!  c") !=
+        std::vector<uint32_t>{'a', 'b', '!', ' ', ' ', 'c'}) {
+        std::cerr << "the regex matcher broke after its time limit"
+                  << std::endl;
+        ok = false;
+    }
+    // a capture group repeated once per byte of the input
+    regex_options.pretokenizer_regex = "(a|b)*c|.";
+    regex_options.regex_time_limit = 0;
+    regex_options.regex_stack_limit = 1000;
+    bpecpp::BPE deep = make_bpe({}, "", regex_options);
+    try {
+        deep.encode(std::string(100000, 'a'));
+        std::cerr << "the regex stack limit did not hit" << std::endl;
+        ok = false;
+    } catch (const bpecpp::bpe_limit_error&) {
+    }
+#endif
+    return ok;
+}
+
+// the tokenizer.json of make_bpe(merges, ""), split by a ByteLevel
+// pre_tokenizer alone and without a normalizer
+static json tokenizer_config(const merge_list& merges) {
+    json vocab = json::object();
+    for (auto& tok : make_vocab(merges, "")) {
+        vocab[to_alphabet(tok.first)] = tok.second;
+    }
+    json rules = json::array();
+    for (auto& merge : merges) {
+        rules.push_back(to_alphabet(merge.first) + " " +
+                        to_alphabet(merge.second));
+    }
+    json model = {{"type", "BPE"},   {"dropout", nullptr},
+                  {"vocab", vocab},  {"merges", rules}};
+    json byte_level = {{"type", "ByteLevel"},
+                       {"add_prefix_space", false},
+                       {"trim_offsets", true},
+                       {"use_regex", true}};
+    return {{"normalizer", nullptr},
+            {"pre_tokenizer", byte_level},
+            {"model", model},
+            {"decoder", {{"type", "ByteLevel"}}}};
+}
+
+// from_tokenizer_json runs each pipeline it reads the way the file says
+// and throws for the stages it cannot run
+static bool test_tokenizer_json() {
+    merge_list merges = {{"t", "h"}, {"th", "e"}, {" ", "the"}};
+    auto vocab = make_vocab(merges, "");
+    const uint32_t the = vocab.at("the");
+    const uint32_t space_the = vocab.at(" the");
+    // a token no merge builds
+    const uint32_t xyz = 300;
+    json base = tokenizer_config(merges);
+    base["model"]["vocab"]["xyz"] = xyz;
+    bool ok = true;
+    auto check = [&](const char* what, const json& config,
+                     bpecpp::pretokenizer_kind kind, const std::string& text,
+                     const std::vector<uint32_t>& expected) {
+        try {
+            bpecpp::BPE bpe = bpecpp::BPE::from_tokenizer_json(config.dump());
+            if (bpe.pretokenizer() == kind && bpe.encode(text) == expected)
+                return;
+        } catch (const std::runtime_error& e) {
+            std::cerr << e.what() << std::endl;
+        }
+        std::cerr << "tokenizer.json with " << what << " encoded wrong"
+                  << std::endl;
+        ok = false;
+    };
+    auto rejects = [&](const char* what, const std::string& json_text) {
+        try {
+            bpecpp::BPE::from_tokenizer_json(json_text);
+            std::cerr << "tokenizer.json with " << what << " was accepted"
+                      << std::endl;
+            ok = false;
+        } catch (const std::runtime_error&) {
+        }
+    };
+    const auto gpt2 = bpecpp::pretokenizer_kind::gpt2_unicode;
+
+    // U+0301 stays a mark of its own without a normalizer
+    check("a null normalizer", base, gpt2, "the e\xcc\x81",
+          {the, ' ', 'e', 0xcc, 0x81});
+    check("a null normalizer", base, gpt2, "xyz", {'x', 'y', 'z'});
+    json config = base;
+    config.erase("normalizer");
+    check("no normalizer", config, gpt2, "the the", {the, space_the});
+    config = base;
+    config["normalizer"] = {{"type", "Sequence"},
+                            {"normalizers", {{{"type", "NFC"}}}}};
+    check("NFC", config, gpt2, "the e\xcc\x81", {the, ' ', 0xc3, 0xa9});
+    config = base;
+    config["pre_tokenizer"]["add_prefix_space"] = true;
+    check("add_prefix_space", config, gpt2, "the", {space_the});
+    config = base;
+    config["model"]["ignore_merges"] = true;
+    check("ignore_merges", config, gpt2, "xyz", {xyz});
+    config = base;
+    config["model"]["merges"] = json::array();
+    for (auto& merge : merges) {
+        config["model"]["merges"].push_back(
+            {to_alphabet(merge.first), to_alphabet(merge.second)});
+    }
+    check("array merges", config, gpt2, "the the", {the, space_the});
+    json split = {{"type", "Split"},
+                  {"pattern", {{"Regex", bpecpp::CL100K_PRETOK_REGEX}}},
+                  {"behavior", "Isolated"},
+                  {"invert", false}};
+    json byte_level = base["pre_tokenizer"];
+    byte_level["use_regex"] = false;
+    config = base;
+    config["pre_tokenizer"] = {{"type", "Sequence"},
+                               {"pretokenizers", {split, byte_level}}};
+    check("a Split and ByteLevel", config,
+          bpecpp::pretokenizer_kind::cl100k, "the the", {the, space_the});
+
+    config = base;
+    config["normalizer"] = {{"type", "Lowercase"}};
+    rejects("a Lowercase normalizer", config.dump());
+    config = base;
+    config["model"]["type"] = "WordPiece";
+    rejects("a WordPiece model", config.dump());
+    config = base;
+    config["model"]["byte_fallback"] = true;
+    rejects("byte_fallback", config.dump());
+    config = base;
+    config["model"]["dropout"] = 0.1;
+    rejects("dropout", config.dump());
+    config = base;
+    config["decoder"] = {{"type", "Metaspace"}};
+    rejects("a Metaspace decoder", config.dump());
+    config = base;
+    config.erase("decoder");
+    rejects("no decoder", config.dump());
+    config = base;
+    config["pre_tokenizer"] = byte_level;
+    rejects("ByteLevel without a regex", config.dump());
+    json removed = split;
+    removed["behavior"] = "Removed";
+    config["pre_tokenizer"] = {{"type", "Sequence"},
+                               {"pretokenizers", {removed, byte_level}}};
+    rejects("a Removed Split", config.dump());
+    config["pre_tokenizer"]["pretokenizers"] = {split, split, byte_level};
+    rejects("two Splits", config.dump());
+    config["pre_tokenizer"]["pretokenizers"] = {split, base["pre_tokenizer"]};
+    rejects("two regexes", config.dump());
+    byte_level["add_prefix_space"] = true;
+    config["pre_tokenizer"]["pretokenizers"] = {split, byte_level};
+    rejects("add_prefix_space after a Split", config.dump());
+    config["pre_tokenizer"]["pretokenizers"] = {byte_level, split};
+    rejects("a Split after ByteLevel", config.dump());
+    rejects("broken JSON", base.dump().substr(1));
+    return ok;
+}
+
+#ifndef BPECPP_NO_ICU
+// random text, heavy on the things the pretokenizer regex treats specially
+static std::string random_text(std::mt19937& rng) {
+    static const char* pieces[] = {
+        "a", "Z", "the", "1", "42", " ", "  ", "\t", "\n", "\r\n", "\v",
+        "\f", "'", "'s", "'t", "'re", "'ve", "'m", "'ll", "'d", "'S", "'r",
+        "-", "?!", "_", "\xc2\x85", "\xc2\xa0", "\xe2\x80\xa8",
+        "\xe3\x80\x80", "\xe1\x9a\x80", "\xe2\x80\x8b", "\xc3\xa9",
+        "e\xcc\x81", "\xcd\x85", "\xd9\xa3", "\xe0\xa5\xab", "\xc2\xb2",
+        "\xe4\xb8\xad", "\xf0\x9f\xa4\x96", "\xf0\x9d\x94\x98",
+        "\xe2\x85\xab", "\xff", "\xe4\xb8", "\x80", "'RE", "'Ll", "'\xc5\xbf",
+        "HELLO", "Hello", "/", "\r", "\xc7\x85", "\xca\xb0", "\xcc\x81",
+        "\xc2\xbd", "123456",
+        // runs longer than a vector register
+        "abcdefghijklmnopqrstuvwxyzABCDEFGHIJ",
+        "0123456789012345678901234567890123", "                                  ",
+        "\n\n\t\t\r\n\n\n\t\t\r\n\n\n\t\t\r\n\n\n\t\t\r\n\n\n\t\t\r\n\n\n",
+        "-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=",
+    };
+    std::string text;
+    size_t len = rng() % 24;
+    for (size_t i = 0; i < len; i++) {
+        if (rng() % 4) {
+            text += pieces[rng() % (sizeof(pieces) / sizeof(pieces[0]))];
+            continue;
+        }
+        // any codepoint but a surrogate, as UTF-8
+        uint32_t cp = rng() % 0x110000;
+        if (cp >= 0xd800 && cp < 0xe000)
+            cp = ' ';
+        bpecpp::append_utf8(text, cp);
+    }
+    return text;
+}
+
+// text no match covers is kept, as a Split pre_tokenizer does
+static bool test_regex_gaps() {
+    bpecpp::bpe_options options;
+    options.pretokenizer_regex = " ";
+    bpecpp::BPE bpe = make_bpe({{"o", "o"}}, "", options);
+    std::vector<std::string> expected = {"hello", " ", "world", " ", "foo"};
+    std::vector<uint32_t> expected_ids = {'h', 'e', 'l', 'l', 'o', ' ', 'w',
+                                          'o', 'r', 'l', 'd', ' ', 'f', 256};
+    if (bpe.pretokenize("hello world foo") != expected ||
+        bpe.encode("hello world foo") != expected_ids) {
+        std::cerr << "regex pretokenizer dropped text between matches"
+                  << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// the hand-written pretokenizers have to split exactly like their regex
+static bool test_pretokenizers() {
+    const std::string patterns[] = {
+        bpecpp::BPE_PRETOK_REGEX, bpecpp::GPT2_PRETOK_REGEX,
+        bpecpp::CL100K_PRETOK_REGEX, bpecpp::O200K_PRETOK_REGEX,
+        // newer tiktoken's spelling of cl100k_base
+        R"('(?i:[sdmt]|ll|ve|re)|[^\r\n\p{L}\p{N}]?+\p{L}+|\p{N}{1,3}| ?[^\s\p{L}\p{N}]++[\r\n]*|\s*[\r\n]|\s+(?!\S)|\s+)"};
+    bool ok = true;
+    for (auto& pattern : patterns) {
+        bpecpp::bpe_options options;
+        options.pretokenizer_regex = pattern;
+        // splitting does not depend on the vocab
+        bpecpp::BPE bpe({}, {}, options);
+        if (bpe.pretokenizer() == bpecpp::pretokenizer_kind::regex) {
+            std::cerr << "no scanner for: " << pattern << std::endl;
+            ok = false;
+            continue;
+        }
+        std::mt19937 rng(1);
+        size_t failures = 0;
+        for (int i = 0; i < 100000; i++) {
+            std::string text = random_text(rng);
+            if (bpe.pretokenize(text) != bpe.pretokenize_regex(text)) {
+                if (failures++ < 10)
+                    std::cerr << "pretokenizer mismatch on: "
+                              << json(text).dump(-1, ' ', false,
+                                                 json::error_handler_t::replace)
+                              << std::endl;
+            }
+        }
+        std::cerr << "pretokenizer mismatches for " << pattern << ": "
+                  << failures << std::endl;
+        ok = ok && failures == 0;
+    }
+    return ok;
+}
+#endif
+
 int main(int argc, char** argv) {
     // https://huggingface.co/mosaicml/mpt-7b-chat/raw/main/tokenizer.json
-    std::ifstream f("../mpt-7b-chat-tokenizer.json");
-    json tokenizer_config = json::parse(f);
+    std::ifstream f(argc > 1 ? argv[1] : "../mpt-7b-chat-tokenizer.json");
+    std::string tokenizer_json((std::istreambuf_iterator<char>(f)),
+                               std::istreambuf_iterator<char>());
+    json tokenizer_config = json::parse(tokenizer_json);
 
     std::vector<bpecpp::additional_vocab_item> added_vocab;
     for (auto javi : tokenizer_config.at("added_tokens")) {
@@ -20,8 +689,8 @@ int main(int argc, char** argv) {
     }
     bpecpp::AdditionalVocabAdapter av(added_vocab);
 
-    json bpeconfig = tokenizer_config.at("model");
-    bpecpp::BPE bpe(bpeconfig.at("vocab"), bpeconfig.at("merges"));
+    // normalizes and pretokenizes the way the file says
+    bpecpp::BPE bpe = bpecpp::BPE::from_tokenizer_json(tokenizer_json);
 
     std::string test_input = "<|im_start|>system\nyou're a helpful AI assistant 🤖 that likes emojis<|im_end|>";
 
@@ -40,5 +709,16 @@ int main(int argc, char** argv) {
     std::cerr << "test invalid utf8 ending" << std::endl;
     final_tokens.resize(11);
     std::cerr << "decoded: " << av.decode(final_tokens, bpe) << std::endl;
-    return 0;
+
+    bool ok = test_missing_bytes();
+    ok = test_engines() && ok;
+    ok = test_ignore_merges() && ok;
+    ok = test_limits() && ok;
+    ok = test_tokenizer_json() && ok;
+    // without ICU there is no regex to test the pretokenizers against
+#ifndef BPECPP_NO_ICU
+    ok = test_regex_gaps() && ok;
+    ok = test_pretokenizers() && ok;
+#endif
+    return ok ? 0 : 1;
 }
\ No newline at end of file
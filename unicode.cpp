@@ -0,0 +1,333 @@
+#include "unicode.h"
+
+#ifndef BPECPP_NO_ICU
+#include <unicode/normalizer2.h>
+#include <unicode/uchar.h>
+#include <unicode/unistr.h>
+#else
+#include "unicode_tables.h"
+#endif
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace bpecpp {
+void append_utf8(std::string& out, int32_t c) {
+    if (c < 0x80) {
+        out += (char)c;
+    } else if (c < 0x800) {
+        out += (char)(0xc0 | (c >> 6));
+        out += (char)(0x80 | (c & 0x3f));
+    } else if (c < 0x10000) {
+        out += (char)(0xe0 | (c >> 12));
+        out += (char)(0x80 | ((c >> 6) & 0x3f));
+        out += (char)(0x80 | (c & 0x3f));
+    } else {
+        out += (char)(0xf0 | (c >> 18));
+        out += (char)(0x80 | ((c >> 12) & 0x3f));
+        out += (char)(0x80 | ((c >> 6) & 0x3f));
+        out += (char)(0x80 | (c & 0x3f));
+    }
+}
+
+size_t ascii_prefix_end(const char* s, size_t len) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    for (; i + 32 <= len; i += 32) {
+        uint32_t high = (uint32_t)_mm256_movemask_epi8(
+            _mm256_loadu_si256((const __m256i*)(s + i)));
+        if (high)
+            return i + __builtin_ctz(high);
+    }
+#elif defined(__SSE2__)
+    for (; i + 16 <= len; i += 16) {
+        uint32_t high = (uint32_t)_mm_movemask_epi8(
+            _mm_loadu_si128((const __m128i*)(s + i)));
+        if (high)
+            return i + __builtin_ctz(high);
+    }
+#endif
+    while (i < len && (uint8_t)s[i] < 0x80) {
+        i++;
+    }
+    return i;
+}
+
+bool is_valid_utf8(const char* s, size_t size) {
+    int32_t i = 0, len = (int32_t)size;
+    while (i < len) {
+        if ((uint8_t)s[i] < 0x80) {
+            i += (int32_t)ascii_prefix_end(s + i, len - i);
+            continue;
+        }
+        if (utf8_next(s, i, len) < 0)
+            return false;
+    }
+    return true;
+}
+
+void replace_invalid_utf8(const char* s, size_t size, std::string& out) {
+    int32_t i = 0, len = (int32_t)size;
+    while (i < len) {
+        int32_t start = i;
+        int32_t c = utf8_next(s, i, len);
+        if (c < 0)
+            append_utf8(out, 0xfffd);
+        else
+            out.append(s + start, i - start);
+    }
+}
+
+#ifndef BPECPP_NO_ICU
+uint32_t category_mask(int32_t c) {
+    return U_GET_GC_MASK(c);
+}
+
+bool is_white_space(int32_t c) {
+    return u_isUWhiteSpace(c);
+}
+
+bool is_alphabetic(int32_t c) {
+    return u_isUAlphabetic(c);
+}
+
+int32_t fold_case_ascii(int32_t c) {
+    int32_t folded = u_foldCase(c, U_FOLD_CASE_DEFAULT);
+    return folded < 0x80 ? folded : c;
+}
+
+byte_span normalize_nfc(byte_span input, std::string& normalized) {
+    size_t ascii = ascii_prefix_end(input.data(), input.size());
+    if (ascii == input.size())
+        return input;
+    UErrorCode uerror = U_ZERO_ERROR;
+    auto nfcnorm = icu::Normalizer2::getNFCInstance(uerror);
+    if (!U_SUCCESS(uerror))
+        throw std::runtime_error("could not get ICU NFC normalizer");
+    // the last ASCII character may combine with what follows, the ones
+    // before it are normalized already
+    size_t cut = ascii ? ascii - 1 : 0;
+    icu::StringPiece tail(input.data() + cut, (int32_t)(input.size() - cut));
+    // ICU passes invalid UTF-8 as normalized, but it has to become U+FFFD
+    if (is_valid_utf8(tail.data(), tail.size()) &&
+        nfcnorm->isNormalizedUTF8(tail, uerror) && U_SUCCESS(uerror))
+        return input;
+    // keep the prefix that passes the quick check and normalize the rest
+    auto icu_tail = icu::UnicodeString::fromUTF8(tail);
+    int32_t span = nfcnorm->spanQuickCheckYes(icu_tail, uerror);
+    normalized.assign(input.data(), cut);
+    icu_tail.tempSubString(0, span).toUTF8String(normalized);
+    nfcnorm->normalize(icu_tail.tempSubString(span), uerror)
+        .toUTF8String(normalized);
+    if (!U_SUCCESS(uerror))
+        throw std::runtime_error("ICU string normalization failed");
+    return normalized;
+}
+#else
+static uint32_t record(int32_t c) {
+    using namespace unicode_tables;
+    uint32_t block = BLOCKS[c >> BLOCK_SHIFT];
+    return RECORDS[BLOCK_DATA[block << BLOCK_SHIFT |
+                              (c & ((1 << BLOCK_SHIFT) - 1))]];
+}
+
+uint32_t category_mask(int32_t c) {
+    return 1u << (record(c) & 0x1f);
+}
+
+bool is_white_space(int32_t c) {
+    return record(c) >> 5 & 1;
+}
+
+bool is_alphabetic(int32_t c) {
+    return record(c) >> 6 & 1;
+}
+
+int32_t fold_case_ascii(int32_t c) {
+    using namespace unicode_tables;
+    if (c < 0x80)
+        return c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c;
+    const uint32_t* end = FOLD_CPS + sizeof(FOLD_CPS) / sizeof(FOLD_CPS[0]);
+    const uint32_t* found = std::find(FOLD_CPS, end, (uint32_t)c);
+    return found == end ? c : FOLD_ASCII[found - FOLD_CPS];
+}
+
+static const uint32_t NFC_QC_YES = 0;
+static const uint32_t NFC_QC_NO = 1;
+
+static uint32_t nfc_quick_check(uint32_t rec) {
+    return rec >> 7 & 3;
+}
+
+static uint8_t combining_class(uint32_t rec) {
+    return (uint8_t)(rec >> 9);
+}
+
+// whether text can be cut before c without changing its NFC, a subset of
+// ICU's hasBoundaryBefore
+static bool has_boundary_before(int32_t c) {
+    uint32_t rec = record(c);
+    return nfc_quick_check(rec) == NFC_QC_YES && !combining_class(rec);
+}
+
+// the Hangul syllables, which compose and decompose algorithmically
+static const int32_t S_BASE = 0xac00, L_BASE = 0x1100, V_BASE = 0x1161,
+                     T_BASE = 0x11a7;
+static const int32_t L_COUNT = 19, V_COUNT = 21, T_COUNT = 28,
+                     S_COUNT = L_COUNT * V_COUNT * T_COUNT;
+
+static void decompose(int32_t c, std::vector<int32_t>& out) {
+    using namespace unicode_tables;
+    if (c >= S_BASE && c < S_BASE + S_COUNT) {
+        int32_t s = c - S_BASE;
+        out.push_back(L_BASE + s / (V_COUNT * T_COUNT));
+        out.push_back(V_BASE + s % (V_COUNT * T_COUNT) / T_COUNT);
+        if (s % T_COUNT)
+            out.push_back(T_BASE + s % T_COUNT);
+        return;
+    }
+    const uint32_t* end =
+        DECOMP_CPS + sizeof(DECOMP_CPS) / sizeof(DECOMP_CPS[0]);
+    const uint32_t* found = std::lower_bound(DECOMP_CPS, end, (uint32_t)c);
+    if (found == end || *found != (uint32_t)c) {
+        out.push_back(c);
+        return;
+    }
+    size_t i = found - DECOMP_CPS;
+    out.insert(out.end(), DECOMP_DATA + DECOMP_START[i],
+               DECOMP_DATA + DECOMP_START[i + 1]);
+}
+
+// what NFC composes first and second into, negative if nothing
+static int32_t compose(int32_t first, int32_t second) {
+    using namespace unicode_tables;
+    if (first >= L_BASE && first < L_BASE + L_COUNT && second >= V_BASE &&
+        second < V_BASE + V_COUNT)
+        return S_BASE +
+               ((first - L_BASE) * V_COUNT + (second - V_BASE)) * T_COUNT;
+    if (first >= S_BASE && first < S_BASE + S_COUNT &&
+        (first - S_BASE) % T_COUNT == 0 && second > T_BASE &&
+        second < T_BASE + T_COUNT)
+        return first + (second - T_BASE);
+    uint64_t key = (uint64_t)first << 21 | (uint64_t)second;
+    const uint64_t* end =
+        COMPOSE_PAIRS + sizeof(COMPOSE_PAIRS) / sizeof(COMPOSE_PAIRS[0]);
+    const uint64_t* found = std::lower_bound(COMPOSE_PAIRS, end, key);
+    if (found == end || *found != key)
+        return -1;
+    return (int32_t)COMPOSE_RESULTS[found - COMPOSE_PAIRS];
+}
+
+// appends the NFC of s[0, len): decomposes, puts combining marks in
+// canonical order and composes again, as in UAX #15
+static void normalize_segment(const char* s, int32_t len, std::string& out) {
+    std::vector<int32_t> cps;
+    for (int32_t i = 0; i < len;) {
+        int32_t c = utf8_next(s, i, len);
+        decompose(c < 0 ? 0xfffd : c, cps);
+    }
+    for (size_t i = 1; i < cps.size(); i++) {
+        uint8_t ccc = combining_class(record(cps[i]));
+        if (!ccc)
+            continue;
+        for (size_t k = i; k > 0; k--) {
+            uint8_t prev = combining_class(record(cps[k - 1]));
+            if (prev <= ccc)
+                break;
+            std::swap(cps[k - 1], cps[k]);
+        }
+    }
+    if (cps.empty())
+        return;
+    size_t starter = 0;
+    size_t kept = 1;
+    // 256 for a leading combining mark, which nothing composes onto
+    int last_ccc = combining_class(record(cps[0])) ? 256 : 0;
+    for (size_t i = 1; i < cps.size(); i++) {
+        int32_t c = cps[i];
+        int ccc = combining_class(record(c));
+        int32_t composed = compose(cps[starter], c);
+        if (composed >= 0 && (last_ccc < ccc || last_ccc == 0)) {
+            cps[starter] = composed;
+            continue;
+        }
+        if (!ccc)
+            starter = kept;
+        last_ccc = ccc;
+        cps[kept++] = c;
+    }
+    for (size_t i = 0; i < kept; i++) {
+        append_utf8(out, cps[i]);
+    }
+}
+
+byte_span normalize_nfc(byte_span input, std::string& normalized) {
+    const char* s = input.data();
+    int32_t len = (int32_t)input.size();
+    int32_t i = (int32_t)ascii_prefix_end(s, len);
+    if (i == len)
+        return input;
+    // the quick check, where a codepoint that is not NFC_QC=Yes or a
+    // combining mark out of order makes the segment around it, from the
+    // last boundary to the next, get normalized. input[0, copied) is in
+    // normalized once something changed
+    static thread_local std::string segment;
+    bool changed = false;
+    int32_t copied = 0;
+    int32_t boundary = i ? i - 1 : 0;
+    uint8_t last_ccc = 0;
+    while (i < len) {
+        if ((uint8_t)s[i] < 0x80) {
+            i += (int32_t)ascii_prefix_end(s + i, len - i);
+            boundary = i - 1;
+            last_ccc = 0;
+            continue;
+        }
+        int32_t start = i;
+        int32_t c = utf8_next(s, i, len);
+        uint32_t rec = c < 0 ? NFC_QC_NO << 7 : record(c);
+        uint8_t ccc = combining_class(rec);
+        if (nfc_quick_check(rec) == NFC_QC_YES && (!ccc || last_ccc <= ccc)) {
+            if (!ccc)
+                boundary = start;
+            last_ccc = ccc;
+            continue;
+        }
+        int32_t end = i;
+        while (end < len) {
+            int32_t next = end;
+            int32_t c2 = utf8_next(s, next, len);
+            if (c2 >= 0 && has_boundary_before(c2))
+                break;
+            end = next;
+        }
+        segment.clear();
+        normalize_segment(s + boundary, end - boundary, segment);
+        // a codepoint that is only NFC_QC=Maybe often stays as it is
+        if (segment.compare(0, std::string::npos, s + boundary,
+                            end - boundary)) {
+            if (!changed)
+                normalized.clear();
+            changed = true;
+            normalized.append(s + copied, boundary - copied);
+            normalized += segment;
+            copied = end;
+        }
+        i = end;
+        boundary = end;
+        last_ccc = 0;
+    }
+    if (!changed)
+        return input;
+    normalized.append(s + copied, len - copied);
+    return normalized;
+}
+#endif
+}  // namespace bpecpp
@@ -0,0 +1,95 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#ifndef BPECPP_NO_ICU
+#include <unicode/utf8.h>
+#endif
+
+#include "pretokenize.h"
+
+namespace bpecpp {
+// the Unicode properties, normalization and UTF-8 handling the library
+// needs. they come from ICU, or with BPECPP_NO_ICU from the tables in
+// unicode_tables.h, which gen_unicode_tables generates from ICU
+
+// general categories as bits, numbered like ICU's UCharCategory so they
+// equal its U_GC_*_MASK
+const uint32_t GC_LU = 1u << 1;
+const uint32_t GC_LL = 1u << 2;
+const uint32_t GC_LT = 1u << 3;
+const uint32_t GC_LM = 1u << 4;
+const uint32_t GC_LO = 1u << 5;
+const uint32_t GC_MN = 1u << 6;
+const uint32_t GC_ME = 1u << 7;
+const uint32_t GC_MC = 1u << 8;
+const uint32_t GC_ND = 1u << 9;
+const uint32_t GC_NL = 1u << 10;
+const uint32_t GC_NO = 1u << 11;
+const uint32_t GC_L = GC_LU | GC_LL | GC_LT | GC_LM | GC_LO;
+const uint32_t GC_M = GC_MN | GC_ME | GC_MC;
+const uint32_t GC_N = GC_ND | GC_NL | GC_NO;
+
+// general category of c as one of the bits above
+uint32_t category_mask(int32_t c);
+bool is_white_space(int32_t c);
+bool is_alphabetic(int32_t c);
+// simple case folding of c if that is ASCII, otherwise c
+int32_t fold_case_ascii(int32_t c);
+
+// codepoint at s[i], moving i past it. negative for invalid UTF-8, of
+// which it skips a maximal subpart like ICU's U8_NEXT
+inline int32_t utf8_next(const char* s, int32_t& i, int32_t len) {
+#ifndef BPECPP_NO_ICU
+    UChar32 c;
+    U8_NEXT(s, i, len, c);
+    return c;
+#else
+    uint8_t lead = (uint8_t)s[i++];
+    if (lead < 0x80)
+        return lead;
+    int32_t c;
+    int trail;
+    // the range of the first trail byte excludes overlong forms,
+    // surrogates and codepoints past U+10FFFF
+    uint8_t lo = 0x80, hi = 0xbf;
+    if (lead >= 0xc2 && lead <= 0xdf) {
+        c = lead & 0x1f;
+        trail = 1;
+    } else if (lead >= 0xe0 && lead <= 0xef) {
+        c = lead & 0x0f;
+        trail = 2;
+        lo = lead == 0xe0 ? 0xa0 : 0x80;
+        hi = lead == 0xed ? 0x9f : 0xbf;
+    } else if (lead >= 0xf0 && lead <= 0xf4) {
+        c = lead & 0x07;
+        trail = 3;
+        lo = lead == 0xf0 ? 0x90 : 0x80;
+        hi = lead == 0xf4 ? 0x8f : 0xbf;
+    } else {
+        return -1;
+    }
+    for (; trail; trail--) {
+        if (i == len || (uint8_t)s[i] < lo || (uint8_t)s[i] > hi)
+            return -1;
+        c = (c << 6) | (s[i++] & 0x3f);
+        lo = 0x80;
+        hi = 0xbf;
+    }
+    return c;
+#endif
+}
+
+void append_utf8(std::string& out, int32_t c);
+// length of the run of ASCII bytes s starts with
+size_t ascii_prefix_end(const char* s, size_t len);
+bool is_valid_utf8(const char* s, size_t len);
+// appends s with every maximal invalid subpart replaced by U+FFFD, the
+// same as a roundtrip through ICU's UTF-16
+void replace_invalid_utf8(const char* s, size_t len, std::string& out);
+
+// input itself if it is NFC already, otherwise normalized after
+// normalizing it into that. invalid UTF-8 becomes U+FFFD
+byte_span normalize_nfc(byte_span input, std::string& normalized);
+}  // namespace bpecpp